@@ -0,0 +1,1021 @@
+#include "Commands/UnrealMCPAssetCommands.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopedSlowTask.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "UObject/ObjectRedirector.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Engine/Texture.h"
+
+namespace
+{
+    /** How many distinct queries keep their results for pagination */
+    constexpr int32 MaxRecentQueries = 8;
+    constexpr int32 DefaultPageSize = 100;
+    constexpr int32 MaxPageSize = 1000;
+    /** Closures stop growing at this many nodes, so referencers of engine content can't walk the whole project */
+    constexpr int32 MaxClosureSize = 20000;
+
+    IAssetRegistry& GetAssetRegistry()
+    {
+        return FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    }
+
+    /** Accept "StaticMesh", "UStaticMesh" or a class path such as "/Script/Engine.StaticMesh" */
+    bool ResolveClassPath(const FString& ClassName, FTopLevelAssetPath& OutClassPath)
+    {
+        if (ClassName.StartsWith(TEXT("/")))
+        {
+            OutClassPath = FTopLevelAssetPath(ClassName);
+            return OutClassPath.IsValid();
+        }
+
+        UClass* Class = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+        if (!Class && ClassName.Len() > 1 && (ClassName[0] == TEXT('U') || ClassName[0] == TEXT('A')))
+        {
+            Class = FindFirstObject<UClass>(*ClassName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+        }
+        if (!Class)
+        {
+            return false;
+        }
+        OutClassPath = Class->GetClassPathName();
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> AssetDataToJson(const FAssetData& Asset, const TArray<FString>& Fields)
+    {
+        TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+        for (const FString& Field : Fields)
+        {
+            if (Field == TEXT("name"))
+            {
+                AssetObj->SetStringField(Field, Asset.AssetName.ToString());
+            }
+            else if (Field == TEXT("path"))
+            {
+                AssetObj->SetStringField(Field, Asset.GetObjectPathString());
+            }
+            else if (Field == TEXT("package"))
+            {
+                AssetObj->SetStringField(Field, Asset.PackageName.ToString());
+            }
+            else if (Field == TEXT("package_path"))
+            {
+                AssetObj->SetStringField(Field, Asset.PackagePath.ToString());
+            }
+            else if (Field == TEXT("class"))
+            {
+                AssetObj->SetStringField(Field, Asset.AssetClassPath.GetAssetName().ToString());
+            }
+            else if (Field == TEXT("class_path"))
+            {
+                AssetObj->SetStringField(Field, Asset.AssetClassPath.ToString());
+            }
+            else if (Field == TEXT("tags"))
+            {
+                TSharedPtr<FJsonObject> Tags = MakeShared<FJsonObject>();
+                Asset.TagsAndValues.ForEach([&Tags](const TPair<FName, FAssetTagValueRef>& Tag)
+                {
+                    Tags->SetStringField(Tag.Key.ToString(), Tag.Value.AsString());
+                });
+                AssetObj->SetObjectField(Field, Tags);
+            }
+            else if (Field.StartsWith(TEXT("tag:")))
+            {
+                // A single tag value, e.g. "tag:ParentClass"
+                FString TagValue;
+                if (Asset.GetTagValue(FName(*Field.RightChop(4)), TagValue))
+                {
+                    AssetObj->SetStringField(Field.RightChop(4), TagValue);
+                }
+            }
+        }
+        return AssetObj;
+    }
+}
+
+FUnrealMCPAssetCommands::FUnrealMCPAssetCommands()
+{
+}
+
+FUnrealMCPAssetCommands::~FUnrealMCPAssetCommands()
+{
+    if (RegistryHandles.Num() > 0 && FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = GetAssetRegistry();
+        AssetRegistry.OnAssetAdded().Remove(RegistryHandles[0]);
+        AssetRegistry.OnAssetRemoved().Remove(RegistryHandles[1]);
+        AssetRegistry.OnAssetRenamed().Remove(RegistryHandles[2]);
+        AssetRegistry.OnAssetUpdated().Remove(RegistryHandles[3]);
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    EnsureRegistryListeners();
+
+    if (CommandType == TEXT("find_assets"))
+    {
+        return HandleFindAssets(Params);
+    }
+    else if (CommandType == TEXT("suggest"))
+    {
+        return HandleSuggest(Params);
+    }
+    else if (CommandType == TEXT("get_asset_dependencies"))
+    {
+        return HandleGetAssetDependencies(Params);
+    }
+    else if (CommandType == TEXT("get_asset_referencers"))
+    {
+        return HandleGetAssetReferencers(Params);
+    }
+    else if (CommandType == TEXT("move_assets"))
+    {
+        return HandleMoveAssets(Params);
+    }
+    else if (CommandType == TEXT("rename_assets"))
+    {
+        return HandleRenameAssets(Params);
+    }
+    else if (CommandType == TEXT("create_material_instances"))
+    {
+        return HandleCreateMaterialInstances(Params);
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown asset command: %s"), *CommandType));
+}
+
+void FUnrealMCPAssetCommands::EnsureRegistryListeners()
+{
+    if (RegistryHandles.Num() > 0)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = GetAssetRegistry();
+    RegistryHandles.Add(AssetRegistry.OnAssetAdded().AddLambda([this](const FAssetData&) { OnRegistryChanged(); }));
+    RegistryHandles.Add(AssetRegistry.OnAssetRemoved().AddLambda([this](const FAssetData&) { OnRegistryChanged(); }));
+    RegistryHandles.Add(AssetRegistry.OnAssetRenamed().AddLambda([this](const FAssetData&, const FString&) { OnRegistryChanged(); }));
+    RegistryHandles.Add(AssetRegistry.OnAssetUpdated().AddLambda([this](const FAssetData&) { OnRegistryChanged(); }));
+}
+
+void FUnrealMCPAssetCommands::OnRegistryChanged()
+{
+    ++RegistryGeneration;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleFindAssets(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get optional parameters
+    FString PackagePath = TEXT("/Game");
+    Params->TryGetStringField(TEXT("path"), PackagePath);
+    PackagePath.RemoveFromEnd(TEXT("/"));
+
+    bool bRecursive = true;
+    Params->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+    FString ClassName;
+    Params->TryGetStringField(TEXT("class"), ClassName);
+
+    bool bRecursiveClasses = true;
+    Params->TryGetBoolField(TEXT("recursive_classes"), bRecursiveClasses);
+
+    FString NamePattern;
+    Params->TryGetStringField(TEXT("name"), NamePattern);
+
+    const TSharedPtr<FJsonObject>* Tags = nullptr;
+    Params->TryGetObjectField(TEXT("tags"), Tags);
+
+    int32 Limit = DefaultPageSize;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Clamp(Limit, 1, MaxPageSize);
+
+    FString Cursor;
+    Params->TryGetStringField(TEXT("cursor"), Cursor);
+
+    TArray<FString> Fields = { TEXT("name"), TEXT("path"), TEXT("class") };
+    const TArray<TSharedPtr<FJsonValue>>* FieldValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("fields"), FieldValues))
+    {
+        Fields.Reset();
+        for (const TSharedPtr<FJsonValue>& FieldValue : *FieldValues)
+        {
+            Fields.Add(FieldValue->AsString());
+        }
+    }
+
+    // Build the registry filter; everything except the name glob is answered by the registry's own indices
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*PackagePath));
+    Filter.bRecursivePaths = bRecursive;
+    if (!ClassName.IsEmpty())
+    {
+        FTopLevelAssetPath ClassPath;
+        if (!ResolveClassPath(ClassName, ClassPath))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::WithNameSuggestions(
+                FString::Printf(TEXT("Unknown class: %s"), *ClassName), ClassName, TEXT("class")));
+        }
+        Filter.ClassPaths.Add(ClassPath);
+        Filter.bRecursiveClasses = bRecursiveClasses;
+    }
+    if (Tags)
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Tag : (*Tags)->Values)
+        {
+            // A null or empty value only requires the tag to be present
+            FString TagValue;
+            if (Tag.Value.IsValid() && Tag.Value->TryGetString(TagValue) && !TagValue.IsEmpty())
+            {
+                Filter.TagsAndValues.Add(FName(*Tag.Key), TagValue);
+            }
+            else
+            {
+                Filter.TagsAndValues.Add(FName(*Tag.Key), TOptional<FString>());
+            }
+        }
+    }
+
+    // The query identity covers everything that selects assets, not the page or projection. Paths and name
+    // globs match case-insensitively and the tags come from an unordered object, so all of them are normalized
+    FAssetQueryKey Key;
+    Key.PackagePath = PackagePath.ToLower();
+    Key.bRecursive = bRecursive;
+    Key.ClassPath = Filter.ClassPaths.Num() > 0 ? Filter.ClassPaths[0] : FTopLevelAssetPath();
+    Key.bRecursiveClasses = bRecursiveClasses;
+    Key.NamePattern = NamePattern.ToLower();
+    for (const TPair<FName, TOptional<FString>>& Tag : Filter.TagsAndValues)
+    {
+        Key.Tags.Emplace(Tag.Key, Tag.Value);
+    }
+    Key.Tags.Sort([](const TPair<FName, TOptional<FString>>& A, const TPair<FName, TOptional<FString>>& B)
+    {
+        return A.Key.LexicalLess(B.Key) || (A.Key == B.Key && A.Value.Get(FString()) < B.Value.Get(FString()));
+    });
+
+    // The hash only tags cursors, so a cursor from another query is rejected instead of paging the wrong result
+    uint32 QueryHash = GetTypeHash(Key.PackagePath);
+    QueryHash = HashCombine(QueryHash, GetTypeHash(Key.bRecursive));
+    QueryHash = HashCombine(QueryHash, GetTypeHash(Key.ClassPath));
+    QueryHash = HashCombine(QueryHash, GetTypeHash(Key.bRecursiveClasses));
+    QueryHash = HashCombine(QueryHash, GetTypeHash(Key.NamePattern));
+    for (const TPair<FName, TOptional<FString>>& Tag : Key.Tags)
+    {
+        QueryHash = HashCombine(QueryHash, HashCombine(GetTypeHash(Tag.Key), GetTypeHash(Tag.Value.Get(FString()))));
+    }
+
+    int32 Offset = 0;
+    if (!Cursor.IsEmpty())
+    {
+        FString CursorHash;
+        FString CursorOffset;
+        if (!Cursor.Split(TEXT(":"), &CursorHash, &CursorOffset) || FParse::HexNumber(*CursorHash) != QueryHash || !CursorOffset.IsNumeric())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Cursor doesn't belong to this query"));
+        }
+        Offset = FMath::Max(0, FCString::Atoi(*CursorOffset));
+    }
+
+    // Reuse the query's sorted result while the registry is unchanged, so pages don't shift under a cursor
+    IAssetRegistry& AssetRegistry = GetAssetRegistry();
+    FAssetQuery* Query = RecentQueries.FindByPredicate([&Key](const FAssetQuery& Recent) { return Recent.Key == Key; });
+    const bool bCached = Query && Query->Generation == RegistryGeneration;
+    if (!bCached)
+    {
+        if (!Query)
+        {
+            if (RecentQueries.Num() >= MaxRecentQueries)
+            {
+                RecentQueries.RemoveAt(0);
+            }
+            Query = &RecentQueries.AddDefaulted_GetRef();
+            Query->Key = Key;
+        }
+
+        Query->Generation = RegistryGeneration;
+        Query->Assets.Reset();
+        AssetRegistry.EnumerateAssets(Filter, [Query, &NamePattern](const FAssetData& Asset)
+        {
+            if (NamePattern.IsEmpty() || Asset.AssetName.ToString().MatchesWildcard(NamePattern))
+            {
+                Query->Assets.Add(Asset);
+            }
+            return true;
+        });
+        Query->Assets.Sort([](const FAssetData& A, const FAssetData& B)
+        {
+            return A.PackageName.LexicalLess(B.PackageName) || (A.PackageName == B.PackageName && A.AssetName.LexicalLess(B.AssetName));
+        });
+    }
+
+    TArray<TSharedPtr<FJsonValue>> AssetArray;
+    const int32 End = FMath::Min(Offset + Limit, Query->Assets.Num());
+    for (int32 Index = Offset; Index < End; ++Index)
+    {
+        AssetArray.Add(MakeShared<FJsonValueObject>(AssetDataToJson(Query->Assets[Index], Fields)));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("assets"), AssetArray);
+    ResultObj->SetNumberField(TEXT("total"), Query->Assets.Num());
+    if (End < Query->Assets.Num())
+    {
+        ResultObj->SetStringField(TEXT("next_cursor"), FString::Printf(TEXT("%08x:%d"), QueryHash, End));
+    }
+    ResultObj->SetBoolField(TEXT("cached"), bCached);
+    ResultObj->SetBoolField(TEXT("registry_loading"), AssetRegistry.IsLoadingAssets());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleSuggest(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString Query;
+    if (!Params->TryGetStringField(TEXT("query"), Query) || Query.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'query' parameter"));
+    }
+
+    // Get optional parameters
+    FString Kind;
+    Params->TryGetStringField(TEXT("kind"), Kind);
+
+    int32 Limit = 10;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Clamp(Limit, 1, 100);
+
+    // An explicit request waits for the index instead of returning nothing while it is built
+    const TArray<FMCPNameSuggestion> Suggestions = FUnrealMCPCommonUtils::SuggestNames(Query, Kind, Limit, true);
+
+    TArray<TSharedPtr<FJsonValue>> SuggestionArray;
+    for (const FMCPNameSuggestion& Suggestion : Suggestions)
+    {
+        TSharedPtr<FJsonObject> SuggestionObj = MakeShared<FJsonObject>();
+        SuggestionObj->SetStringField(TEXT("name"), Suggestion.Name);
+        SuggestionObj->SetStringField(TEXT("path"), Suggestion.Path);
+        SuggestionObj->SetStringField(TEXT("kind"), Suggestion.Kind);
+        SuggestionObj->SetNumberField(TEXT("score"), Suggestion.Score);
+        SuggestionArray.Add(MakeShared<FJsonValueObject>(SuggestionObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("query"), Query);
+    ResultObj->SetArrayField(TEXT("suggestions"), SuggestionArray);
+    ResultObj->SetBoolField(TEXT("registry_loading"), GetAssetRegistry().IsLoadingAssets());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleGetAssetDependencies(const TSharedPtr<FJsonObject>& Params)
+{
+    return HandleDependencyQuery(Params, false);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleGetAssetReferencers(const TSharedPtr<FJsonObject>& Params)
+{
+    return HandleDependencyQuery(Params, true);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleDependencyQuery(const TSharedPtr<FJsonObject>& Params, bool bReferencers)
+{
+    using namespace UE::AssetRegistry;
+
+    // Get required parameters
+    FString AssetName;
+    if (!Params->TryGetStringField(TEXT("asset"), AssetName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'asset' parameter"));
+    }
+
+    // Get optional parameters
+    int32 Depth = 1;
+    Params->TryGetNumberField(TEXT("depth"), Depth);
+
+    bool bHard = true;
+    Params->TryGetBoolField(TEXT("hard"), bHard);
+
+    bool bSoft = true;
+    Params->TryGetBoolField(TEXT("soft"), bSoft);
+
+    bool bSearchableNames = false;
+    Params->TryGetBoolField(TEXT("searchable_names"), bSearchableNames);
+
+    bool bIncludeScript = false;
+    Params->TryGetBoolField(TEXT("include_script"), bIncludeScript);
+
+    if (!bHard && !bSoft && !bSearchableNames)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("At least one of 'hard', 'soft' and 'searchable_names' must be true"));
+    }
+
+    FName RootPackage;
+    FString ErrorMessage;
+    if (!FUnrealMCPCommonUtils::ResolveAssetPackage(AssetName, RootPackage, ErrorMessage))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    EDependencyCategory Category = EDependencyCategory::None;
+    FDependencyQuery Query;
+    if (bHard || bSoft)
+    {
+        Category |= EDependencyCategory::Package;
+        if (bHard != bSoft)
+        {
+            Query = FDependencyQuery(bHard ? EDependencyQuery::Hard : EDependencyQuery::Soft);
+        }
+    }
+    if (bSearchableNames)
+    {
+        Category |= EDependencyCategory::SearchableName;
+    }
+
+    // The closure is kept per root and filter while the registry is unchanged; depth only decides how much of it is walked
+    FDependencyClosureKey Key;
+    Key.RootPackage = RootPackage;
+    Key.bReferencers = bReferencers;
+    Key.bHard = bHard;
+    Key.bSoft = bSoft;
+    Key.bSearchableNames = bSearchableNames;
+    Key.bIncludeScript = bIncludeScript;
+
+    FDependencyClosure* Closure = RecentClosures.FindByPredicate([&Key](const FDependencyClosure& Recent) { return Recent.Key == Key; });
+    if (Closure && Closure->Generation != RegistryGeneration)
+    {
+        *Closure = FDependencyClosure();
+        Closure->Key = Key;
+    }
+    if (!Closure)
+    {
+        if (RecentClosures.Num() >= MaxRecentQueries)
+        {
+            RecentClosures.RemoveAt(0);
+        }
+        Closure = &RecentClosures.AddDefaulted_GetRef();
+        Closure->Key = Key;
+    }
+    if (Closure->Nodes.Num() == 0)
+    {
+        Closure->Generation = RegistryGeneration;
+        Closure->Nodes.Add({ FAssetIdentifier(RootPackage), 0, INDEX_NONE, true });
+        Closure->NodeIndices.Add(Closure->Nodes[0].Id, 0);
+    }
+
+    // Walk the registry's dependency graph breadth first from the deepest level reached so far. Only the registry's
+    // own dependency data is read, so no package is loaded.
+    const int32 TargetDepth = Depth <= 0 ? MAX_int32 : Depth;
+    const bool bCached = Closure->bComplete || Closure->bTruncated || Closure->ExpandedDepth >= TargetDepth;
+    IAssetRegistry& AssetRegistry = GetAssetRegistry();
+    int32 LevelStart = Closure->Nodes.IndexOfByPredicate([Closure](const FDependencyNode& Node) { return Node.Depth == Closure->ExpandedDepth; });
+    TArray<FAssetDependency> Edges;
+    while (!Closure->bComplete && !Closure->bTruncated && Closure->ExpandedDepth < TargetDepth)
+    {
+        const int32 LevelEnd = Closure->Nodes.Num();
+        for (int32 NodeIndex = LevelStart; NodeIndex < LevelEnd && !Closure->bTruncated; ++NodeIndex)
+        {
+            // Searchable names are leaves; what they belong to is reached through the package edge
+            const FAssetIdentifier NodeId = Closure->Nodes[NodeIndex].Id;
+            if (!NodeId.IsPackage())
+            {
+                continue;
+            }
+
+            Edges.Reset();
+            if (bReferencers)
+            {
+                AssetRegistry.GetReferencers(NodeId, Edges, Category, Query);
+            }
+            else
+            {
+                AssetRegistry.GetDependencies(NodeId, Edges, Category, Query);
+            }
+
+            for (const FAssetDependency& Edge : Edges)
+            {
+                if (!bIncludeScript && Edge.AssetId.PackageName.ToString().StartsWith(TEXT("/Script/")))
+                {
+                    continue;
+                }
+                if (Closure->NodeIndices.Contains(Edge.AssetId))
+                {
+                    continue;
+                }
+                if (Closure->Nodes.Num() >= MaxClosureSize)
+                {
+                    Closure->bTruncated = true;
+                    break;
+                }
+
+                const bool bHardEdge = Edge.Category == EDependencyCategory::Package && EnumHasAnyFlags(Edge.Properties, EDependencyProperty::Hard);
+                Closure->NodeIndices.Add(Edge.AssetId, Closure->Nodes.Num());
+                Closure->Nodes.Add({ Edge.AssetId, Closure->ExpandedDepth + 1, NodeIndex, bHardEdge });
+            }
+        }
+
+        ++Closure->ExpandedDepth;
+        Closure->bComplete = !Closure->bTruncated && LevelEnd == Closure->Nodes.Num();
+        LevelStart = LevelEnd;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> NodeArray;
+    TArray<FAssetData> PackageAssets;
+    for (int32 NodeIndex = 1; NodeIndex < Closure->Nodes.Num(); ++NodeIndex)
+    {
+        const FDependencyNode& Node = Closure->Nodes[NodeIndex];
+        if (Node.Depth > TargetDepth)
+        {
+            break;
+        }
+
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("package"), Node.Id.PackageName.ToString());
+        if (Node.Id.IsPackage())
+        {
+            // The class of the package's primary asset, from the registry's cached asset data
+            PackageAssets.Reset();
+            AssetRegistry.GetAssetsByPackageName(Node.Id.PackageName, PackageAssets);
+            if (PackageAssets.Num() > 0)
+            {
+                NodeObj->SetStringField(TEXT("class"), PackageAssets[0].AssetClassPath.GetAssetName().ToString());
+            }
+            NodeObj->SetBoolField(TEXT("hard"), Node.bHard);
+        }
+        else
+        {
+            NodeObj->SetStringField(TEXT("searchable_name"), Node.Id.ToString());
+        }
+        NodeObj->SetNumberField(TEXT("depth"), Node.Depth);
+        if (Node.Via > 0)
+        {
+            NodeObj->SetStringField(TEXT("via"), Closure->Nodes[Node.Via].Id.PackageName.ToString());
+        }
+        NodeArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("asset"), RootPackage.ToString());
+    ResultObj->SetArrayField(bReferencers ? TEXT("referencers") : TEXT("dependencies"), NodeArray);
+    ResultObj->SetNumberField(TEXT("count"), NodeArray.Num());
+    // Complete when nothing lies beyond the returned nodes, i.e. this is the whole transitive closure
+    ResultObj->SetBoolField(TEXT("complete"), Closure->bComplete && NodeArray.Num() == Closure->Nodes.Num() - 1);
+    ResultObj->SetBoolField(TEXT("truncated"), Closure->bTruncated);
+    ResultObj->SetBoolField(TEXT("cached"), bCached);
+    ResultObj->SetBoolField(TEXT("registry_loading"), AssetRegistry.IsLoadingAssets());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleMoveAssets(const TSharedPtr<FJsonObject>& Params)
+{
+    return RenameAssetBatch(Params, true);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleRenameAssets(const TSharedPtr<FJsonObject>& Params)
+{
+    return RenameAssetBatch(Params, false);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::RenameAssetBatch(const TSharedPtr<FJsonObject>& Params, bool bMove)
+{
+    // Get required parameters
+    const TCHAR* EntriesField = bMove ? TEXT("moves") : TEXT("renames");
+    const TArray<TSharedPtr<FJsonValue>>* EntryValues = nullptr;
+    if (!Params->TryGetArrayField(EntriesField, EntryValues))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Missing '%s' parameter"), EntriesField));
+    }
+
+    // Get optional parameters
+    bool bFixupRedirectors = true;
+    Params->TryGetBoolField(TEXT("fixup_redirectors"), bFixupRedirectors);
+
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    TArray<TSharedPtr<FJsonValue>> Phases;
+    auto AddPhase = [&Phases](const FString& Phase, int32 Completed, int32 Total, double StartTime)
+    {
+        TSharedPtr<FJsonObject> PhaseObj = MakeShared<FJsonObject>();
+        PhaseObj->SetStringField(TEXT("phase"), Phase);
+        PhaseObj->SetNumberField(TEXT("completed"), Completed);
+        PhaseObj->SetNumberField(TEXT("total"), Total);
+        PhaseObj->SetNumberField(TEXT("seconds"), FPlatformTime::Seconds() - StartTime);
+        Phases.Add(MakeShared<FJsonValueObject>(PhaseObj));
+        UE_LOG(LogTemp, Display, TEXT("UnrealMCP: %s %d/%d"), *Phase, Completed, Total);
+    };
+
+    // Editor progress for validation, the rename batch and the redirector fixup
+    FScopedSlowTask SlowTask(3.0f, bMove ? FText::FromString(TEXT("Moving assets")) : FText::FromString(TEXT("Renaming assets")));
+    SlowTask.MakeDialogDelayed(1.0f);
+
+    // Validate every entry before touching anything; invalid entries are reported and left out of the batch
+    double PhaseStart = FPlatformTime::Seconds();
+    SlowTask.EnterProgressFrame(1.0f, FText::FromString(TEXT("Validating")));
+    TArray<FAssetRenameData> Batch;
+    TArray<FSoftObjectPath> OldPaths;
+    TSet<FString> Destinations;
+    for (int32 EntryIndex = 0; EntryIndex < EntryValues->Num(); ++EntryIndex)
+    {
+        auto AddError = [&Errors, EntryIndex](const FString& Error)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("[%d] %s"), EntryIndex, *Error)));
+        };
+
+        const TSharedPtr<FJsonObject>* EntryPtr = nullptr;
+        FString Source;
+        if (!(*EntryValues)[EntryIndex]->TryGetObject(EntryPtr) || !(*EntryPtr)->TryGetStringField(TEXT("source"), Source))
+        {
+            AddError(TEXT("Entry is missing 'source'"));
+            continue;
+        }
+        const TSharedPtr<FJsonObject>& Entry = *EntryPtr;
+
+        FName SourcePackage;
+        FString ErrorMessage;
+        if (!FUnrealMCPCommonUtils::ResolveAssetPackage(Source, SourcePackage, ErrorMessage))
+        {
+            AddError(ErrorMessage);
+            continue;
+        }
+
+        FAssetData SourceAsset;
+        if (!FUnrealMCPCommonUtils::GetPrimaryAsset(SourcePackage, SourceAsset))
+        {
+            AddError(FString::Printf(TEXT("No asset in package %s"), *SourcePackage.ToString()));
+            continue;
+        }
+
+        FString NewPath = SourceAsset.PackagePath.ToString();
+        FString NewName = SourceAsset.AssetName.ToString();
+        if (bMove)
+        {
+            if (!Entry->TryGetStringField(TEXT("destination"), NewPath))
+            {
+                AddError(TEXT("Entry is missing 'destination'"));
+                continue;
+            }
+            NewPath.RemoveFromEnd(TEXT("/"));
+            Entry->TryGetStringField(TEXT("name"), NewName);
+        }
+        else if (!Entry->TryGetStringField(TEXT("new_name"), NewName))
+        {
+            AddError(TEXT("Entry is missing 'new_name'"));
+            continue;
+        }
+
+        const FString NewPackage = NewPath + TEXT("/") + NewName;
+        FText Reason;
+        if (!FPackageName::IsValidLongPackageName(NewPackage, false, &Reason))
+        {
+            AddError(FString::Printf(TEXT("Invalid destination %s: %s"), *NewPackage, *Reason.ToString()));
+            continue;
+        }
+        if (NewPackage == SourcePackage.ToString())
+        {
+            AddError(FString::Printf(TEXT("%s is already at its destination"), *NewPackage));
+            continue;
+        }
+        // Unsaved assets and ones still pending delete hold their path too, so loaded objects are checked as well
+        UObject* ExistingAsset = nullptr;
+        if (!FUnrealMCPCommonUtils::FindAssetForCreate(NewPackage, NewName, UObject::StaticClass(), ExistingAsset, ErrorMessage))
+        {
+            AddError(ErrorMessage);
+            continue;
+        }
+        bool bDestinationTaken = false;
+        Destinations.Add(NewPackage.ToLower(), &bDestinationTaken);
+        if (bDestinationTaken || ExistingAsset)
+        {
+            AddError(FString::Printf(TEXT("Destination %s is already taken"), *NewPackage));
+            continue;
+        }
+
+        // Paths only; asset tools loads each asset as part of the batch
+        OldPaths.Add(SourceAsset.GetSoftObjectPath());
+        Batch.Emplace(SourceAsset.GetSoftObjectPath(), FSoftObjectPath(NewPackage + TEXT(".") + NewName));
+    }
+    AddPhase(TEXT("validate"), EntryValues->Num() - Errors.Num(), EntryValues->Num(), PhaseStart);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    TArray<TSharedPtr<FJsonValue>> Renamed;
+    if (Batch.Num() > 0)
+    {
+        // One batch, so referencers shared by several assets are loaded and updated once
+        PhaseStart = FPlatformTime::Seconds();
+        SlowTask.EnterProgressFrame(1.0f, FText::FromString(FString::Printf(TEXT("Renaming %d assets"), Batch.Num())));
+        IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+        const bool bRenamed = AssetTools.RenameAssets(Batch);
+
+        TArray<UObjectRedirector*> Redirectors;
+        for (int32 BatchIndex = 0; BatchIndex < Batch.Num(); ++BatchIndex)
+        {
+            UObject* Asset = Batch[BatchIndex].NewObjectPath.ResolveObject();
+            if (!Asset)
+            {
+                Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Failed to rename %s to %s"), *OldPaths[BatchIndex].ToString(), *Batch[BatchIndex].NewObjectPath.ToString())));
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> RenamedObj = MakeShared<FJsonObject>();
+            RenamedObj->SetStringField(TEXT("source"), OldPaths[BatchIndex].ToString());
+            RenamedObj->SetStringField(TEXT("destination"), Batch[BatchIndex].NewObjectPath.ToString());
+            Renamed.Add(MakeShared<FJsonValueObject>(RenamedObj));
+            FUnrealMCPCommonUtils::QueueAssetSave(Asset);
+
+            if (UObjectRedirector* Redirector = FindObject<UObjectRedirector>(nullptr, *OldPaths[BatchIndex].ToString()))
+            {
+                Redirectors.Add(Redirector);
+            }
+        }
+        AddPhase(TEXT("rename"), Renamed.Num(), Batch.Num(), PhaseStart);
+
+        // A single fixup pass over all redirectors, without a source control prompt per package
+        PhaseStart = FPlatformTime::Seconds();
+        SlowTask.EnterProgressFrame(1.0f, FText::FromString(FString::Printf(TEXT("Fixing up %d redirectors"), Redirectors.Num())));
+        if (bFixupRedirectors && Redirectors.Num() > 0)
+        {
+            AssetTools.FixupReferencers(Redirectors, false);
+            AddPhase(TEXT("fixup_redirectors"), Redirectors.Num(), Redirectors.Num(), PhaseStart);
+        }
+        ResultObj->SetNumberField(TEXT("redirectors"), Redirectors.Num());
+        ResultObj->SetBoolField(TEXT("redirectors_fixed"), bFixupRedirectors && Redirectors.Num() > 0);
+
+        if (!bRenamed && Renamed.Num() == 0)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to %s assets: %s"), bMove ? TEXT("move") : TEXT("rename"),
+                *FString::JoinBy(Errors, TEXT("; "), [](const TSharedPtr<FJsonValue>& Error) { return Error->AsString(); })));
+        }
+    }
+
+    ResultObj->SetArrayField(bMove ? TEXT("moved") : TEXT("renamed"), Renamed);
+    ResultObj->SetNumberField(TEXT("count"), Renamed.Num());
+    ResultObj->SetArrayField(TEXT("errors"), Errors);
+    ResultObj->SetArrayField(TEXT("progress"), Phases);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPAssetCommands::HandleCreateMaterialInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString ParentName;
+    if (!Params->TryGetStringField(TEXT("parent"), ParentName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'parent' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* InstanceValues = nullptr;
+    if (!Params->TryGetArrayField(TEXT("instances"), InstanceValues))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'instances' parameter"));
+    }
+
+    // Get optional parameters
+    FString PackagePath = TEXT("/Game/Materials");
+    Params->TryGetStringField(TEXT("path"), PackagePath);
+    PackagePath.RemoveFromEnd(TEXT("/"));
+
+    bool bOverwrite = false;
+    Params->TryGetBoolField(TEXT("overwrite"), bOverwrite);
+
+    FString ErrorMessage;
+    UMaterialInterface* Parent = FUnrealMCPCommonUtils::LoadResolvedAsset<UMaterialInterface>(ParentName, ErrorMessage);
+    if (!Parent)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+
+    // The parent's parameters are looked up once for the whole batch instead of per instance and override
+    TMap<FName, FMaterialParameterInfo> ScalarParameters;
+    TMap<FName, FMaterialParameterInfo> VectorParameters;
+    TMap<FName, FMaterialParameterInfo> TextureParameters;
+    auto CollectParameters = [](const TArray<FMaterialParameterInfo>& Infos, TMap<FName, FMaterialParameterInfo>& OutParameters)
+    {
+        for (const FMaterialParameterInfo& Info : Infos)
+        {
+            OutParameters.Add(Info.Name, Info);
+        }
+    };
+    {
+        TArray<FMaterialParameterInfo> Infos;
+        TArray<FGuid> Ids;
+        Parent->GetAllScalarParameterInfo(Infos, Ids);
+        CollectParameters(Infos, ScalarParameters);
+        Parent->GetAllVectorParameterInfo(Infos, Ids);
+        CollectParameters(Infos, VectorParameters);
+        Parent->GetAllTextureParameterInfo(Infos, Ids);
+        CollectParameters(Infos, TextureParameters);
+    }
+
+    struct FInstanceSpec
+    {
+        FString Name;
+        TArray<TPair<FMaterialParameterInfo, float>> Scalars;
+        TArray<TPair<FMaterialParameterInfo, FLinearColor>> Vectors;
+        TArray<TPair<FMaterialParameterInfo, UTexture*>> Textures;
+    };
+
+    // Validate every instance before creating any, so a bad override doesn't leave half a batch behind
+    TArray<FInstanceSpec> Specs;
+    TArray<FString> Errors;
+    TSet<FString> Names;
+    TMap<FString, UTexture*> Textures;
+    for (int32 InstanceIndex = 0; InstanceIndex < InstanceValues->Num(); ++InstanceIndex)
+    {
+        const TSharedPtr<FJsonObject>* InstancePtr = nullptr;
+        FInstanceSpec Spec;
+        if (!(*InstanceValues)[InstanceIndex]->TryGetObject(InstancePtr) || !(*InstancePtr)->TryGetStringField(TEXT("name"), Spec.Name) || Spec.Name.IsEmpty())
+        {
+            Errors.Add(FString::Printf(TEXT("[%d] Instance is missing 'name'"), InstanceIndex));
+            continue;
+        }
+        const TSharedPtr<FJsonObject>& Instance = *InstancePtr;
+        auto AddError = [&Errors, &Spec](const FString& Error)
+        {
+            Errors.Add(FString::Printf(TEXT("%s: %s"), *Spec.Name, *Error));
+        };
+
+        bool bDuplicate = false;
+        Names.Add(Spec.Name, &bDuplicate);
+        if (bDuplicate)
+        {
+            AddError(TEXT("Instance name appears more than once"));
+            continue;
+        }
+
+        auto FindParameter = [&AddError](const TMap<FName, FMaterialParameterInfo>& Parameters, const FString& ParameterName, const TCHAR* Type)
+        {
+            const FMaterialParameterInfo* Info = Parameters.Find(FName(*ParameterName));
+            if (!Info)
+            {
+                AddError(FString::Printf(TEXT("Parent has no %s parameter '%s'"), Type, *ParameterName));
+            }
+            return Info;
+        };
+
+        const TSharedPtr<FJsonObject>* Scalars = nullptr;
+        if (Instance->TryGetObjectField(TEXT("scalars"), Scalars))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Scalar : (*Scalars)->Values)
+            {
+                double Value = 0.0;
+                const FMaterialParameterInfo* Info = FindParameter(ScalarParameters, Scalar.Key, TEXT("scalar"));
+                if (Info && !Scalar.Value->TryGetNumber(Value))
+                {
+                    AddError(FString::Printf(TEXT("Scalar '%s' must be a number"), *Scalar.Key));
+                }
+                else if (Info)
+                {
+                    Spec.Scalars.Emplace(*Info, (float)Value);
+                }
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* Vectors = nullptr;
+        if (Instance->TryGetObjectField(TEXT("vectors"), Vectors))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Vector : (*Vectors)->Values)
+            {
+                const FMaterialParameterInfo* Info = FindParameter(VectorParameters, Vector.Key, TEXT("vector"));
+                if (!Info)
+                {
+                    continue;
+                }
+
+                // [r, g, b], [r, g, b, a] or {"r", "g", "b", "a"}
+                FLinearColor Color(0.0f, 0.0f, 0.0f, 1.0f);
+                const TArray<TSharedPtr<FJsonValue>>* Components = nullptr;
+                const TSharedPtr<FJsonObject>* ColorObject = nullptr;
+                if (Vector.Value->TryGetArray(Components) && (Components->Num() == 3 || Components->Num() == 4))
+                {
+                    Color.R = (float)(*Components)[0]->AsNumber();
+                    Color.G = (float)(*Components)[1]->AsNumber();
+                    Color.B = (float)(*Components)[2]->AsNumber();
+                    Color.A = Components->Num() == 4 ? (float)(*Components)[3]->AsNumber() : 1.0f;
+                }
+                else if (Vector.Value->TryGetObject(ColorObject))
+                {
+                    auto GetChannel = [ColorObject](const TCHAR* Channel, float Default)
+                    {
+                        double Value = Default;
+                        (*ColorObject)->TryGetNumberField(Channel, Value);
+                        return (float)Value;
+                    };
+                    Color = FLinearColor(GetChannel(TEXT("r"), 0.0f), GetChannel(TEXT("g"), 0.0f), GetChannel(TEXT("b"), 0.0f), GetChannel(TEXT("a"), 1.0f));
+                }
+                else
+                {
+                    AddError(FString::Printf(TEXT("Vector '%s' must be [r, g, b], [r, g, b, a] or {r, g, b, a}"), *Vector.Key));
+                    continue;
+                }
+                Spec.Vectors.Emplace(*Info, Color);
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* TextureSpecs = nullptr;
+        if (Instance->TryGetObjectField(TEXT("textures"), TextureSpecs))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& TextureSpec : (*TextureSpecs)->Values)
+            {
+                const FMaterialParameterInfo* Info = FindParameter(TextureParameters, TextureSpec.Key, TEXT("texture"));
+                if (!Info)
+                {
+                    continue;
+                }
+
+                // Each texture is loaded once however many instances use it
+                const FString TextureName = TextureSpec.Value->AsString();
+                UTexture** Texture = Textures.Find(TextureName);
+                if (!Texture)
+                {
+                    FString TextureError;
+                    Texture = &Textures.Add(TextureName, FUnrealMCPCommonUtils::LoadResolvedAsset<UTexture>(TextureName, TextureError));
+                    if (!*Texture)
+                    {
+                        AddError(TextureError);
+                    }
+                }
+                if (*Texture)
+                {
+                    Spec.Textures.Emplace(*Info, *Texture);
+                }
+            }
+        }
+
+        Specs.Add(MoveTemp(Spec));
+    }
+
+    if (Errors.Num() > 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("No material instances created: %s"), *FString::Join(Errors, TEXT("; "))));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Created;
+    TArray<TSharedPtr<FJsonValue>> Updated;
+    TArray<TSharedPtr<FJsonValue>> Skipped;
+    TArray<TSharedPtr<FJsonValue>> Failed;
+    for (const FInstanceSpec& Spec : Specs)
+    {
+        const FString PackageName = PackagePath / Spec.Name;
+        const FString ObjectPath = PackageName + TEXT(".") + Spec.Name;
+
+        // Objects still only in memory count as existing too, so NewObject never lands on top of one
+        UObject* Existing = nullptr;
+        if (!FUnrealMCPCommonUtils::FindAssetForCreate(PackageName, Spec.Name, UMaterialInstanceConstant::StaticClass(), Existing, ErrorMessage))
+        {
+            Failed.Add(MakeShared<FJsonValueString>(ErrorMessage));
+            continue;
+        }
+
+        UMaterialInstanceConstant* MaterialInstance = Cast<UMaterialInstanceConstant>(Existing);
+        const bool bCreated = MaterialInstance == nullptr;
+        if (!bCreated)
+        {
+            if (!bOverwrite)
+            {
+                Skipped.Add(MakeShared<FJsonValueString>(ObjectPath));
+                continue;
+            }
+            MaterialInstance->Modify();
+            MaterialInstance->ClearParameterValuesEditorOnly();
+        }
+        else
+        {
+            UPackage* Package = CreatePackage(*PackageName);
+            MaterialInstance = NewObject<UMaterialInstanceConstant>(Package, FName(*Spec.Name), RF_Public | RF_Standalone | RF_Transactional);
+        }
+
+        // The overrides don't touch shaders; PostEditChange updates the instance's resources once at the end
+        MaterialInstance->SetParentEditorOnly(Parent, false);
+        for (const TPair<FMaterialParameterInfo, float>& Scalar : Spec.Scalars)
+        {
+            MaterialInstance->SetScalarParameterValueEditorOnly(Scalar.Key, Scalar.Value);
+        }
+        for (const TPair<FMaterialParameterInfo, FLinearColor>& Vector : Spec.Vectors)
+        {
+            MaterialInstance->SetVectorParameterValueEditorOnly(Vector.Key, Vector.Value);
+        }
+        for (const TPair<FMaterialParameterInfo, UTexture*>& Texture : Spec.Textures)
+        {
+            MaterialInstance->SetTextureParameterValueEditorOnly(Texture.Key, Texture.Value);
+        }
+        MaterialInstance->PostEditChange();
+
+        if (bCreated)
+        {
+            FAssetRegistryModule::AssetCreated(MaterialInstance);
+        }
+        MaterialInstance->MarkPackageDirty();
+        FUnrealMCPCommonUtils::QueueAssetSave(MaterialInstance);
+        (bCreated ? Created : Updated).Add(MakeShared<FJsonValueString>(ObjectPath));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("parent"), Parent->GetPathName());
+    ResultObj->SetArrayField(TEXT("created"), Created);
+    ResultObj->SetArrayField(TEXT("updated"), Updated);
+    ResultObj->SetArrayField(TEXT("skipped"), Skipped);
+    ResultObj->SetArrayField(TEXT("errors"), Failed);
+    ResultObj->SetNumberField(TEXT("count"), Created.Num() + Updated.Num());
+    return ResultObj;
+}
@@ -20,22 +20,319 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
-#include "EditorAssetLibrary.h"
+#include "Containers/Ticker.h"
+#include "FindInBlueprintManager.h"
+#include "FindInBlueprints.h"
+
+/** A set of blueprints compiled in batches, either in one call or one batch per editor tick */
+struct FMCPBlueprintCompileJob
+{
+    FString Id;
+    TArray<FSoftObjectPath> Pending;
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int32 Total = 0;
+    int32 BatchSize = 0;
+    bool bDirtyOnly = false;
+    double StartTime = 0.0;
+    double ElapsedMs = 0.0;
+    double CompletedTime = 0.0;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    bool IsDone() const { return Pending.Num() == 0; }
+};
+
+/** A Find-in-Blueprints search running on its own thread, polled by id */
+struct FMCPBlueprintSearch
+{
+    FString Id;
+    FString Query;
+    TSharedPtr<FStreamSearch> Search;
+    int32 MaxResults = 50;
+    double StartTime = 0.0;
+};
+
+namespace
+{
+    /** Resolve a parent class name such as "Pawn" or "ACharacter" for a new actor blueprint */
+    UClass* FindBlueprintParentClass(const FString& ParentClass)
+    {
+        FString ClassName = ParentClass;
+        if (!ClassName.StartsWith(TEXT("A")))
+        {
+            ClassName = TEXT("A") + ClassName;
+        }
+        
+        // First try direct StaticClass lookup for common classes
+        if (ClassName == TEXT("APawn"))
+        {
+            return APawn::StaticClass();
+        }
+        else if (ClassName == TEXT("AActor"))
+        {
+            return AActor::StaticClass();
+        }
+
+        // Try loading the class using LoadClass which is more reliable than FindObject
+        const FString ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
+        UClass* FoundClass = LoadClass<AActor>(nullptr, *ClassPath);
+        
+        if (!FoundClass)
+        {
+            // Try alternate paths if not found
+            const FString GameClassPath = FString::Printf(TEXT("/Script/Game.%s"), *ClassName);
+            FoundClass = LoadClass<AActor>(nullptr, *GameClassPath);
+        }
+        return FoundClass;
+    }
+
+    /** Resolve a component type such as "StaticMesh", "UStaticMeshComponent" or "PointLightComponent" */
+    UClass* FindComponentClass(const FString& ComponentType)
+    {
+        // Try to find the class with exact name first
+        UClass* ComponentClass = FindObject<UClass>(nullptr, *ComponentType);
+        
+        // If not found, try with "Component" suffix
+        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
+        {
+            FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
+            ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithSuffix);
+        }
+        
+        // If still not found, try with "U" prefix
+        if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
+        {
+            FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
+            ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithPrefix);
+            
+            // Try with both prefix and suffix
+            if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
+            {
+                FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
+                ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithBoth);
+            }
+        }
+        return ComponentClass;
+    }
+
+    UBlueprint* CreateBlueprintAsset(const FString& PackagePath, const FString& AssetName, UClass* ParentClass)
+    {
+        UBlueprintFactory* Factory = NewObject<UBlueprintFactory>();
+        Factory->ParentClass = ParentClass;
+
+        UPackage* Package = CreatePackage(*(PackagePath + AssetName));
+        UBlueprint* NewBlueprint = Cast<UBlueprint>(Factory->FactoryCreateNew(UBlueprint::StaticClass(), Package, *AssetName, RF_Standalone | RF_Public, nullptr, GWarn));
+        if (NewBlueprint)
+        {
+            // Notify the asset registry
+            FAssetRegistryModule::AssetCreated(NewBlueprint);
+
+            // Mark the package dirty
+            Package->MarkPackageDirty();
+        }
+        return NewBlueprint;
+    }
+
+    /** Move an SCS node under NewParent, or make it a root node when NewParent is null */
+    void AttachSCSNode(USimpleConstructionScript* SCS, USCS_Node* Node, USCS_Node* NewParent)
+    {
+        if (USCS_Node* OldParent = SCS->FindParentNode(Node))
+        {
+            OldParent->RemoveChildNode(Node);
+        }
+        else if (SCS->GetRootNodes().Contains(Node))
+        {
+            SCS->RemoveNode(Node, false);
+        }
+
+        if (NewParent)
+        {
+            NewParent->AddChildNode(Node);
+        }
+        else
+        {
+            SCS->AddNode(Node);
+        }
+    }
+
+    /**
+     * Attach a component node to the component named ParentName, which is either another SCS node of the blueprint or a
+     * scene component inherited from a native parent class. An empty ParentName makes the node a root node.
+     */
+    bool AttachComponentNode(UBlueprint* Blueprint, USCS_Node* Node, const FString& ParentName, FString& OutErrorMessage)
+    {
+        USimpleConstructionScript* SCS = Blueprint->SimpleConstructionScript;
+        if (ParentName.IsEmpty())
+        {
+            if (SCS->FindParentNode(Node) || Node->ParentComponentOrVariableName != NAME_None)
+            {
+                Node->ParentComponentOrVariableName = NAME_None;
+                Node->ParentComponentOwnerClassName = NAME_None;
+                Node->bIsParentComponentNative = false;
+                AttachSCSNode(SCS, Node, nullptr);
+            }
+            return true;
+        }
+
+        if (!Cast<USceneComponent>(Node->ComponentTemplate))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Component '%s' is not a scene component"), *Node->GetVariableName().ToString());
+            return false;
+        }
+
+        if (USCS_Node* ParentNode = FUnrealMCPCommonUtils::FindSCSNode(SCS, FName(*ParentName)))
+        {
+            if (!Cast<USceneComponent>(ParentNode->ComponentTemplate))
+            {
+                OutErrorMessage = FString::Printf(TEXT("Parent component '%s' is not a scene component"), *ParentName);
+                return false;
+            }
+            for (USCS_Node* Ancestor = ParentNode; Ancestor; Ancestor = SCS->FindParentNode(Ancestor))
+            {
+                if (Ancestor == Node)
+                {
+                    OutErrorMessage = FString::Printf(TEXT("Cannot attach '%s' to itself or its descendant '%s'"), *Node->GetVariableName().ToString(), *ParentName);
+                    return false;
+                }
+            }
+
+            if (SCS->FindParentNode(Node) != ParentNode)
+            {
+                Node->ParentComponentOrVariableName = NAME_None;
+                Node->ParentComponentOwnerClassName = NAME_None;
+                Node->bIsParentComponentNative = false;
+                AttachSCSNode(SCS, Node, ParentNode);
+            }
+            return true;
+        }
+
+        // Components of a native parent class aren't SCS nodes; the node stays a root node that references its parent by name
+        AActor* ParentDefaultActor = Blueprint->ParentClass ? Cast<AActor>(Blueprint->ParentClass->GetDefaultObject()) : nullptr;
+        if (ParentDefaultActor)
+        {
+            for (UActorComponent* Component : ParentDefaultActor->GetComponents())
+            {
+                USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+                if (SceneComponent && SceneComponent->GetFName() == FName(*ParentName))
+                {
+                    if (SCS->FindParentNode(Node))
+                    {
+                        AttachSCSNode(SCS, Node, nullptr);
+                    }
+                    Node->SetParent(SceneComponent);
+                    return true;
+                }
+            }
+        }
+
+        OutErrorMessage = FString::Printf(TEXT("Parent component not found: %s"), *ParentName);
+        return false;
+    }
+
+    /** Load and compile the next batch of a job. Returns true while blueprints remain */
+    bool RunCompileJobBatch(FMCPBlueprintCompileJob& Job)
+    {
+        const int32 Count = Job.BatchSize > 0 ? FMath::Min(Job.BatchSize, Job.Pending.Num()) : Job.Pending.Num();
+
+        TArray<UBlueprint*> ToCompile;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const FSoftObjectPath& Path = Job.Pending[Index];
+            UBlueprint* Blueprint = Cast<UBlueprint>(Path.TryLoad());
+            if (!Blueprint)
+            {
+                TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+                ResultObj->SetStringField(TEXT("path"), Path.ToString());
+                ResultObj->SetBoolField(TEXT("compiled"), false);
+                ResultObj->SetStringField(TEXT("error"), TEXT("Failed to load blueprint"));
+                Job.Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+            }
+            else if (Job.bDirtyOnly && FUnrealMCPCommonUtils::IsBlueprintUpToDate(Blueprint))
+            {
+                TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::CompileBlueprint(Blueprint);
+                ResultObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+                Job.Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+            }
+            else
+            {
+                ToCompile.Add(Blueprint);
+            }
+        }
+        Job.Pending.RemoveAt(0, Count);
+
+        if (ToCompile.Num() > 0)
+        {
+            Job.Results.Append(FUnrealMCPCommonUtils::CompileBlueprints(ToCompile));
+        }
+
+        Job.ElapsedMs = (FPlatformTime::Seconds() - Job.StartTime) * 1000.0;
+        if (Job.IsDone())
+        {
+            Job.CompletedTime = FPlatformTime::Seconds();
+            Job.TickerHandle.Reset();
+        }
+        return !Job.IsDone();
+    }
+
+    /** Completed jobs nobody has fetched are dropped after this long */
+    constexpr double CompletedCompileJobLifetimeSeconds = 600.0;
+
+    TSharedPtr<FJsonObject> CompileJobToJson(const FMCPBlueprintCompileJob& Job)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("job_id"), Job.Id);
+        ResultObj->SetStringField(TEXT("state"), Job.IsDone() ? TEXT("completed") : TEXT("running"));
+        ResultObj->SetNumberField(TEXT("total"), Job.Total);
+        ResultObj->SetNumberField(TEXT("processed"), Job.Total - Job.Pending.Num());
+        ResultObj->SetNumberField(TEXT("elapsed_ms"), Job.ElapsedMs);
+        ResultObj->SetArrayField(TEXT("results"), Job.Results);
+        return ResultObj;
+    }
+}
 
 FUnrealMCPBlueprintCommands::FUnrealMCPBlueprintCommands()
 {
 }
 
+FUnrealMCPBlueprintCommands::~FUnrealMCPBlueprintCommands()
+{
+    // Background compiles hold the job in their ticker, which would otherwise keep running after the handler is gone
+    for (const TPair<FString, TSharedPtr<FMCPBlueprintCompileJob>>& Entry : CompileJobs)
+    {
+        if (Entry.Value->TickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(Entry.Value->TickerHandle);
+        }
+    }
+
+    // Search threads must not outlive the handler
+    for (const TPair<FString, TSharedPtr<FMCPBlueprintSearch>>& Entry : BlueprintSearches)
+    {
+        if (Entry.Value->Search.IsValid())
+        {
+            Entry.Value->Search->Stop();
+            Entry.Value->Search->EnsureCompletion();
+        }
+    }
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
     if (CommandType == TEXT("create_blueprint"))
     {
         return HandleCreateBlueprint(Params);
     }
+    else if (CommandType == TEXT("create_blueprint_from_spec"))
+    {
+        return HandleCreateBlueprintFromSpec(Params);
+    }
     else if (CommandType == TEXT("add_component_to_blueprint"))
     {
         return HandleAddComponentToBlueprint(Params);
     }
+    else if (CommandType == TEXT("attach_components"))
+    {
+        return HandleAttachComponents(Params);
+    }
     else if (CommandType == TEXT("set_component_property"))
     {
         return HandleSetComponentProperty(Params);
@@ -48,6 +345,30 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString
     {
         return HandleCompileBlueprint(Params);
     }
+    else if (CommandType == TEXT("lint_blueprint"))
+    {
+        return HandleLintBlueprint(Params);
+    }
+    else if (CommandType == TEXT("search_blueprints"))
+    {
+        return HandleSearchBlueprints(Params);
+    }
+    else if (CommandType == TEXT("get_blueprint_search"))
+    {
+        return HandleGetBlueprintSearch(Params);
+    }
+    else if (CommandType == TEXT("compile_blueprints"))
+    {
+        return HandleCompileBlueprints(Params);
+    }
+    else if (CommandType == TEXT("get_compile_job"))
+    {
+        return HandleGetCompileJob(Params);
+    }
+    else if (CommandType == TEXT("flush_blueprint_compiles"))
+    {
+        return HandleFlushBlueprintCompiles(Params);
+    }
     else if (CommandType == TEXT("spawn_blueprint_actor"))
     {
         return HandleSpawnBlueprintActor(Params);
@@ -85,9 +406,6 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprint(const
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint already exists: %s"), *BlueprintName));
     }
 
-    // Create the blueprint factory
-    UBlueprintFactory* Factory = NewObject<UBlueprintFactory>();
-    
     // Handle parent class
     FString ParentClass;
     Params->TryGetStringField(TEXT("parent_class"), ParentClass);
@@ -98,69 +416,331 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprint(const
     // Try to find the specified parent class
     if (!ParentClass.IsEmpty())
     {
-        FString ClassName = ParentClass;
-        if (!ClassName.StartsWith(TEXT("A")))
+        if (UClass* FoundClass = FindBlueprintParentClass(ParentClass))
         {
-            ClassName = TEXT("A") + ClassName;
+            SelectedParentClass = FoundClass;
+            UE_LOG(LogTemp, Log, TEXT("Successfully set parent class to '%s'"), *FoundClass->GetName());
         }
-        
-        // First try direct StaticClass lookup for common classes
-        UClass* FoundClass = nullptr;
-        if (ClassName == TEXT("APawn"))
+        else
         {
-            FoundClass = APawn::StaticClass();
+            UE_LOG(LogTemp, Warning, TEXT("Could not find specified parent class '%s' in /Script/Engine or /Script/Game, defaulting to AActor"), *ParentClass);
         }
-        else if (ClassName == TEXT("AActor"))
+    }
+    
+    // Create the blueprint
+    UBlueprint* NewBlueprint = CreateBlueprintAsset(PackagePath, AssetName, SelectedParentClass);
+    if (NewBlueprint)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), AssetName);
+        ResultObj->SetStringField(TEXT("path"), PackagePath + AssetName);
+        return ResultObj;
+    }
+
+    return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create blueprint"));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprintFromSpec(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    FString ParentClassName;
+    UClass* ParentClass = AActor::StaticClass();
+    if (Params->TryGetStringField(TEXT("parent_class"), ParentClassName))
+    {
+        ParentClass = FindBlueprintParentClass(ParentClassName);
+        if (!ParentClass)
         {
-            FoundClass = AActor::StaticClass();
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::WithNameSuggestions(FString::Printf(TEXT("Parent class not found: %s"), *ParentClassName), ParentClassName, TEXT("class")));
         }
-        else
+    }
+
+    // Everything the spec changes is recorded, so applying the same spec twice is a no-op the second time
+    TArray<TSharedPtr<FJsonValue>> Changes;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    auto AddChange = [&Changes](const FString& Change) { Changes.Add(MakeShared<FJsonValueString>(Change)); };
+    auto AddError = [&Errors](const FString& Error) { Errors.Add(MakeShared<FJsonValueString>(Error)); };
+    bool bNeedsCompile = false;
+
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    const bool bCreated = Blueprint == nullptr;
+    if (!Blueprint)
+    {
+        Blueprint = CreateBlueprintAsset(TEXT("/Game/Blueprints/"), BlueprintName, ParentClass);
+        if (!Blueprint)
         {
-            // Try loading the class using LoadClass which is more reliable than FindObject
-            const FString ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
-            FoundClass = LoadClass<AActor>(nullptr, *ClassPath);
-            
-            if (!FoundClass)
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create blueprint"));
+        }
+        AddChange(FString::Printf(TEXT("created with parent %s"), *ParentClass->GetName()));
+    }
+    else if (!ParentClassName.IsEmpty() && Blueprint->ParentClass != ParentClass)
+    {
+        // Same steps as reparenting in the blueprint editor: nodes that call into the old parent are refreshed against the new one
+        Blueprint->Modify();
+        Blueprint->ParentClass = ParentClass;
+        FBlueprintEditorUtils::RefreshAllNodes(Blueprint);
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+        bNeedsCompile = true;
+        AddChange(FString::Printf(TEXT("reparented to %s"), *ParentClass->GetName()));
+    }
+
+    // Components. Nodes are created as root nodes first and attached in a second pass, so parents may appear after their children
+    const TArray<TSharedPtr<FJsonValue>>* ComponentArray = nullptr;
+    USimpleConstructionScript* SCS = Blueprint->SimpleConstructionScript;
+    if (Params->TryGetArrayField(TEXT("components"), ComponentArray) && SCS)
+    {
+        TArray<TPair<USCS_Node*, TSharedPtr<FJsonObject>>> ComponentSpecs;
+
+        for (const TSharedPtr<FJsonValue>& ComponentValue : *ComponentArray)
+        {
+            const TSharedPtr<FJsonObject>* ComponentSpecPtr = nullptr;
+            FString ComponentName;
+            if (!ComponentValue->TryGetObject(ComponentSpecPtr) || !(*ComponentSpecPtr)->TryGetStringField(TEXT("name"), ComponentName))
             {
-                // Try alternate paths if not found
-                const FString GameClassPath = FString::Printf(TEXT("/Script/Game.%s"), *ClassName);
-                FoundClass = LoadClass<AActor>(nullptr, *GameClassPath);
+                AddError(TEXT("Component spec is missing 'name'"));
+                continue;
             }
+            const TSharedPtr<FJsonObject>& ComponentSpec = *ComponentSpecPtr;
+
+            FString ComponentType;
+            ComponentSpec->TryGetStringField(TEXT("type"), ComponentType);
+            UClass* ComponentClass = ComponentType.IsEmpty() ? nullptr : FindComponentClass(ComponentType);
+            if (!ComponentType.IsEmpty() && (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass())))
+            {
+                AddError(FUnrealMCPCommonUtils::WithNameSuggestions(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType), ComponentType, TEXT("class")));
+                continue;
+            }
+
+            USCS_Node* Node = FUnrealMCPCommonUtils::FindSCSNode(SCS, FName(*ComponentName));
+            if (Node)
+            {
+                if (ComponentClass && Node->ComponentClass != ComponentClass)
+                {
+                    AddError(FString::Printf(TEXT("Component '%s' already exists as %s"), *ComponentName, *Node->ComponentClass->GetName()));
+                    continue;
+                }
+            }
+            else
+            {
+                if (!ComponentClass)
+                {
+                    AddError(FString::Printf(TEXT("Missing 'type' for new component '%s'"), *ComponentName));
+                    continue;
+                }
+                Node = SCS->CreateNode(ComponentClass, FName(*ComponentName));
+                SCS->AddNode(Node);
+                AddChange(FString::Printf(TEXT("added component %s (%s)"), *ComponentName, *ComponentClass->GetName()));
+                bNeedsCompile = true;
+            }
+
+            ComponentSpecs.Emplace(Node, ComponentSpec);
         }
 
-        if (FoundClass)
+        for (const TPair<USCS_Node*, TSharedPtr<FJsonObject>>& Entry : ComponentSpecs)
         {
-            SelectedParentClass = FoundClass;
-            UE_LOG(LogTemp, Log, TEXT("Successfully set parent class to '%s'"), *ClassName);
+            USCS_Node* Node = Entry.Key;
+            const TSharedPtr<FJsonObject>& ComponentSpec = Entry.Value;
+            const FString ComponentName = Node->GetVariableName().ToString();
+
+            // Attachment only changes when the spec names a parent
+            FString ParentName;
+            if (ComponentSpec->TryGetStringField(TEXT("parent"), ParentName) && !ParentName.IsEmpty())
+            {
+                const USCS_Node* OldParentNode = SCS->FindParentNode(Node);
+                const FName OldParentName = Node->ParentComponentOrVariableName;
+
+                FString ErrorMessage;
+                if (!AttachComponentNode(Blueprint, Node, ParentName, ErrorMessage))
+                {
+                    AddError(ErrorMessage);
+                }
+                else if (SCS->FindParentNode(Node) != OldParentNode || Node->ParentComponentOrVariableName != OldParentName)
+                {
+                    AddChange(FString::Printf(TEXT("attached %s to %s"), *ComponentName, *ParentName));
+                    bNeedsCompile = true;
+                }
+            }
+
+            // Transform and properties of the component template
+            UObject* ComponentTemplate = Node->ComponentTemplate;
+            if (USceneComponent* SceneComponent = Cast<USceneComponent>(ComponentTemplate))
+            {
+                if (ComponentSpec->HasField(TEXT("location")))
+                {
+                    const FVector Location = FUnrealMCPCommonUtils::GetVectorFromJson(ComponentSpec, TEXT("location"));
+                    if (!SceneComponent->GetRelativeLocation().Equals(Location))
+                    {
+                        SceneComponent->SetRelativeLocation(Location);
+                        AddChange(FString::Printf(TEXT("%s.location"), *ComponentName));
+                        bNeedsCompile = true;
+                    }
+                }
+                if (ComponentSpec->HasField(TEXT("rotation")))
+                {
+                    const FRotator Rotation = FUnrealMCPCommonUtils::GetRotatorFromJson(ComponentSpec, TEXT("rotation"));
+                    if (!SceneComponent->GetRelativeRotation().Equals(Rotation))
+                    {
+                        SceneComponent->SetRelativeRotation(Rotation);
+                        AddChange(FString::Printf(TEXT("%s.rotation"), *ComponentName));
+                        bNeedsCompile = true;
+                    }
+                }
+                if (ComponentSpec->HasField(TEXT("scale")))
+                {
+                    const FVector Scale = FUnrealMCPCommonUtils::GetVectorFromJson(ComponentSpec, TEXT("scale"));
+                    if (!SceneComponent->GetRelativeScale3D().Equals(Scale))
+                    {
+                        SceneComponent->SetRelativeScale3D(Scale);
+                        AddChange(FString::Printf(TEXT("%s.scale"), *ComponentName));
+                        bNeedsCompile = true;
+                    }
+                }
+            }
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (ComponentTemplate && ComponentSpec->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values)
+                {
+                    bool bChanged = false;
+                    FString ErrorMessage;
+                    if (!FUnrealMCPCommonUtils::UpdateObjectProperty(ComponentTemplate, Property.Key, Property.Value, bChanged, ErrorMessage))
+                    {
+                        AddError(FString::Printf(TEXT("%s.%s: %s"), *ComponentName, *Property.Key, *ErrorMessage));
+                    }
+                    else if (bChanged)
+                    {
+                        AddChange(FString::Printf(TEXT("%s.%s"), *ComponentName, *Property.Key));
+                        bNeedsCompile = true;
+                    }
+                }
+            }
         }
-        else
+    }
+
+    if (SCS && bNeedsCompile)
+    {
+        SCS->ValidateSceneRootNodes();
+    }
+
+    // Variables are added straight to the description list; the single compile below builds them
+    TMap<FString, TSharedPtr<FJsonValue>> VariableDefaults;
+    const TArray<TSharedPtr<FJsonValue>>* VariableArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("variables"), VariableArray))
+    {
+        for (const TSharedPtr<FJsonValue>& VariableValue : *VariableArray)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Could not find specified parent class '%s' at paths: /Script/Engine.%s or /Script/Game.%s, defaulting to AActor"), 
-                *ClassName, *ClassName, *ClassName);
+            const TSharedPtr<FJsonObject>* VariableSpecPtr = nullptr;
+            FString VariableName;
+            if (!VariableValue->TryGetObject(VariableSpecPtr) || !(*VariableSpecPtr)->TryGetStringField(TEXT("name"), VariableName))
+            {
+                AddError(TEXT("Variable spec is missing 'name'"));
+                continue;
+            }
+            const TSharedPtr<FJsonObject>& VariableSpec = *VariableSpecPtr;
+
+            FEdGraphPinType PinType;
+            FString ErrorMessage;
+            if (!FUnrealMCPCommonUtils::ParsePinType(VariableSpec->TryGetField(TEXT("type")), PinType, ErrorMessage))
+            {
+                AddError(FString::Printf(TEXT("%s: %s"), *VariableName, *ErrorMessage));
+                continue;
+            }
+
+            const int32 VariableIndex = FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, FName(*VariableName));
+            FBPVariableDescription* Variable = nullptr;
+            if (VariableIndex == INDEX_NONE)
+            {
+                Variable = &Blueprint->NewVariables.Add_GetRef(FUnrealMCPCommonUtils::MakeVariableDescription(FName(*VariableName), PinType));
+                AddChange(FString::Printf(TEXT("added variable %s"), *VariableName));
+                bNeedsCompile = true;
+            }
+            else
+            {
+                if (Blueprint->NewVariables[VariableIndex].VarType != PinType)
+                {
+                    // Also fixes up the getter and setter nodes of the variable and regenerates the skeleton
+                    FBlueprintEditorUtils::ChangeMemberVariableType(Blueprint, FName(*VariableName), PinType);
+                    AddChange(FString::Printf(TEXT("changed type of variable %s"), *VariableName));
+                    bNeedsCompile = true;
+                }
+                Variable = &Blueprint->NewVariables[VariableIndex];
+            }
+
+            FString Category;
+            if (VariableSpec->TryGetStringField(TEXT("category"), Category) && !Variable->Category.EqualTo(FText::FromString(Category)))
+            {
+                Variable->Category = FText::FromString(Category);
+                AddChange(FString::Printf(TEXT("%s.category"), *VariableName));
+                bNeedsCompile = true;
+            }
+
+            // Defaults live on the class default object, which only has the property after compiling
+            if (TSharedPtr<FJsonValue> DefaultValue = VariableSpec->TryGetField(TEXT("default_value")))
+            {
+                VariableDefaults.Add(VariableName, DefaultValue);
+            }
         }
     }
-    
-    Factory->ParentClass = SelectedParentClass;
 
-    // Create the blueprint
-    UPackage* Package = CreatePackage(*(PackagePath + AssetName));
-    UBlueprint* NewBlueprint = Cast<UBlueprint>(Factory->FactoryCreateNew(UBlueprint::StaticClass(), Package, *AssetName, RF_Standalone | RF_Public, nullptr, GWarn));
+    TSharedPtr<FJsonObject> CompileResult;
+    if (bNeedsCompile)
+    {
+        CompileResult = FUnrealMCPCommonUtils::CompileBlueprint(Blueprint, true);
+    }
 
-    if (NewBlueprint)
+    // Class defaults, including variable defaults
+    const TSharedPtr<FJsonObject>* Defaults = nullptr;
+    if (Params->TryGetObjectField(TEXT("defaults"), Defaults))
     {
-        // Notify the asset registry
-        FAssetRegistryModule::AssetCreated(NewBlueprint);
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Default : (*Defaults)->Values)
+        {
+            VariableDefaults.Add(Default.Key, Default.Value);
+        }
+    }
 
-        // Mark the package dirty
-        Package->MarkPackageDirty();
+    UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+    bool bDefaultsChanged = false;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Default : VariableDefaults)
+    {
+        bool bChanged = false;
+        FString ErrorMessage;
+        if (!FUnrealMCPCommonUtils::UpdateObjectProperty(DefaultObject, Default.Key, Default.Value, bChanged, ErrorMessage))
+        {
+            AddError(FString::Printf(TEXT("%s: %s"), *Default.Key, *ErrorMessage));
+        }
+        else if (bChanged)
+        {
+            AddChange(FString::Printf(TEXT("default %s"), *Default.Key));
+            bDefaultsChanged = true;
+        }
+    }
+    if (bDefaultsChanged)
+    {
+        Blueprint->MarkPackageDirty();
+    }
 
-        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-        ResultObj->SetStringField(TEXT("name"), AssetName);
-        ResultObj->SetStringField(TEXT("path"), PackagePath + AssetName);
-        return ResultObj;
+    if (Changes.Num() > 0)
+    {
+        FUnrealMCPCommonUtils::QueueAssetSave(Blueprint);
     }
 
-    return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create blueprint"));
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("name"), BlueprintName);
+    ResultObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+    ResultObj->SetBoolField(TEXT("created"), bCreated);
+    ResultObj->SetArrayField(TEXT("changes"), Changes);
+    ResultObj->SetArrayField(TEXT("errors"), Errors);
+    if (CompileResult.IsValid())
+    {
+        ResultObj->SetObjectField(TEXT("compile"), CompileResult);
+    }
+    return ResultObj;
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBlueprint(const TSharedPtr<FJsonObject>& Params)
@@ -188,40 +768,16 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Create the component - dynamically find the component class by name
-    UClass* ComponentClass = nullptr;
-
-    // Try to find the class with exact name first
-    ComponentClass = FindObject<UClass>(nullptr, *ComponentType);
-    
-    // If not found, try with "Component" suffix
-    if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-    {
-        FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
-        ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithSuffix);
-    }
-    
-    // If still not found, try with "U" prefix
-    if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
-    {
-        FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
-        ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithPrefix);
-        
-        // Try with both prefix and suffix
-        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-        {
-            FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
-            ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithBoth);
-        }
-    }
+    UClass* ComponentClass = FindComponentClass(ComponentType);
     
     // Verify that the class is a valid component type
     if (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::WithNameSuggestions(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType), ComponentType, TEXT("class")));
     }
 
     // Add the component to the blueprint
@@ -242,17 +798,29 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
             }
             if (Params->HasField(TEXT("scale")))
             {
-                SceneComponent->SetRelativeScale3D(FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale")));
+                SceneComponent->SetRelativeScale3D(FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale")));
+            }
+        }
+
+        // Add to root if no parent specified
+        Blueprint->SimpleConstructionScript->AddNode(NewNode);
+
+        FString ParentComponentName;
+        if (Params->TryGetStringField(TEXT("parent_component"), ParentComponentName))
+        {
+            FString ErrorMessage;
+            if (!AttachComponentNode(Blueprint, NewNode, ParentComponentName, ErrorMessage))
+            {
+                Blueprint->SimpleConstructionScript->RemoveNode(NewNode);
+                return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
             }
+            Blueprint->SimpleConstructionScript->ValidateSceneRootNodes();
         }
 
-        // Add to root if no parent specified
-        Blueprint->SimpleConstructionScript->AddNode(NewNode);
-
         // Compile the blueprint
-        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        FUnrealMCPCommonUtils::CompileBlueprint(Blueprint);
 
-        UEditorAssetLibrary::SaveAsset(Blueprint->GetPathName(), false);
+        FUnrealMCPCommonUtils::QueueAssetSave(Blueprint);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("component_name"), ComponentName);
@@ -263,7 +831,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAddComponentToBluepri
     return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to add component to blueprint"));
 }
 
-TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleAttachComponents(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
     FString BlueprintName;
@@ -272,10 +840,81 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
     }
 
-    FString ComponentName;
-    if (!Params->TryGetStringField(TEXT("component_name"), ComponentName))
+    const TArray<TSharedPtr<FJsonValue>>* Attachments = nullptr;
+    if (!Params->TryGetArrayField(TEXT("attachments"), Attachments))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'component_name' parameter"));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'attachments' parameter"));
+    }
+
+    // Find the blueprint
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint || !Blueprint->SimpleConstructionScript)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+    }
+
+    // Attachments are applied in order, so later entries see the hierarchy produced by earlier ones
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int32 AttachedCount = 0;
+    for (const TSharedPtr<FJsonValue>& AttachmentValue : *Attachments)
+    {
+        const TSharedPtr<FJsonObject>* Attachment = nullptr;
+        FString ComponentName;
+        FString ParentName;
+        if (!AttachmentValue->TryGetObject(Attachment) || !(*Attachment)->TryGetStringField(TEXT("component"), ComponentName))
+        {
+            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+            ResultObj->SetBoolField(TEXT("attached"), false);
+            ResultObj->SetStringField(TEXT("error"), TEXT("Attachment is missing 'component'"));
+            Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+            continue;
+        }
+        (*Attachment)->TryGetStringField(TEXT("parent"), ParentName);
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("component"), ComponentName);
+        ResultObj->SetStringField(TEXT("parent"), ParentName);
+
+        FString ErrorMessage;
+        USCS_Node* Node = FUnrealMCPCommonUtils::FindSCSNode(Blueprint->SimpleConstructionScript, FName(*ComponentName));
+        if (!Node)
+        {
+            ErrorMessage = FString::Printf(TEXT("Component not found: %s"), *ComponentName);
+        }
+        else if (AttachComponentNode(Blueprint, Node, ParentName, ErrorMessage))
+        {
+            ++AttachedCount;
+        }
+
+        ResultObj->SetBoolField(TEXT("attached"), ErrorMessage.IsEmpty());
+        if (!ErrorMessage.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("error"), ErrorMessage);
+        }
+        Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+    }
+
+    if (AttachedCount > 0)
+    {
+        Blueprint->SimpleConstructionScript->ValidateSceneRootNodes();
+        FUnrealMCPCommonUtils::CompileBlueprint(Blueprint, true);
+        FUnrealMCPCommonUtils::QueueAssetSave(Blueprint);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint"), BlueprintName);
+    ResultObj->SetNumberField(TEXT("attached_count"), AttachedCount);
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
     }
 
     FString PropertyName;
@@ -284,6 +923,18 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_name' parameter"));
     }
 
+    FString ComponentName;
+    if (!Params->TryGetStringField(TEXT("component_name"), ComponentName))
+    {
+        // Without component_name the first segment of the property path names the component
+        FString ComponentPropertyPath;
+        if (!PropertyName.Split(TEXT("."), &ComponentName, &ComponentPropertyPath))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'component_name' parameter"));
+        }
+        PropertyName = ComponentPropertyPath;
+    }
+
     // Log all input parameters for debugging
     UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Blueprint: %s, Component: %s, Property: %s"), 
         *BlueprintName, *ComponentName, *PropertyName);
@@ -316,7 +967,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
     if (!Blueprint)
     {
         UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Blueprint not found: %s"), *BlueprintName);
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
     else
     {
@@ -335,22 +986,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid blueprint construction script"));
     }
     
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node)
-        {
-            UE_LOG(LogTemp, Verbose, TEXT("SetComponentProperty - Found node: %s"), *Node->GetVariableName().ToString());
-            if (Node->GetVariableName().ToString() == ComponentName)
-            {
-                ComponentNode = Node;
-                break;
-            }
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Found NULL node in blueprint"));
-        }
-    }
+    ComponentNode = FUnrealMCPCommonUtils::FindSCSNode(Blueprint->SimpleConstructionScript, FName(*ComponentName));
 
     if (!ComponentNode)
     {
@@ -372,6 +1008,31 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetComponentProperty(
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid component template"));
     }
 
+    // Nested or indexed property paths go through the generic path resolver
+    if (PropertyName.Contains(TEXT(".")) || PropertyName.Contains(TEXT("[")))
+    {
+        if (!Params->HasField(TEXT("property_value")))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'property_value' parameter"));
+        }
+
+        TSharedPtr<FJsonValue> JsonValue = Params->Values.FindRef(TEXT("property_value"));
+        FString ErrorMessage;
+        if (!FUnrealMCPCommonUtils::SetObjectProperty(ComponentTemplate, PropertyName, JsonValue, ErrorMessage))
+        {
+            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set property path %s: %s"), *PropertyName, *ErrorMessage);
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+        }
+
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("component"), ComponentName);
+        ResultObj->SetStringField(TEXT("property"), PropertyName);
+        ResultObj->SetBoolField(TEXT("success"), true);
+        return ResultObj;
+    }
+
     // Check if this is a Spring Arm component and log special debug info
     if (ComponentTemplate->GetClass()->GetName().Contains(TEXT("SpringArm")))
     {
@@ -771,19 +1432,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Find the component
-    USCS_Node* ComponentNode = nullptr;
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node && Node->GetVariableName().ToString() == ComponentName)
-        {
-            ComponentNode = Node;
-            break;
-        }
-    }
+    USCS_Node* ComponentNode = FUnrealMCPCommonUtils::FindSCSNode(Blueprint->SimpleConstructionScript, FName(*ComponentName));
 
     if (!ComponentNode)
     {
@@ -841,15 +1494,366 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprint(cons
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
-    // Compile the blueprint
-    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    FString Mode = TEXT("full");
+    Params->TryGetStringField(TEXT("mode"), Mode);
 
-    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    // Skeleton mode only validates; the full compile waits for flush_blueprint_compiles or a full compile_blueprint
+    if (Mode == TEXT("skeleton"))
+    {
+        PendingFullCompiles.Add(Blueprint);
+        TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::ValidateBlueprintSkeleton(Blueprint);
+        ResultObj->SetStringField(TEXT("name"), BlueprintName);
+        return ResultObj;
+    }
+    else if (Mode != TEXT("full"))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown compile mode: %s"), *Mode));
+    }
+
+    // Compile the blueprint, skipping the compile when nothing changed since the last one
+    bool bForce = false;
+    Params->TryGetBoolField(TEXT("force"), bForce);
+
+    PendingFullCompiles.Remove(Blueprint);
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::CompileBlueprint(Blueprint, bForce);
+    ResultObj->SetStringField(TEXT("name"), BlueprintName);
+    return ResultObj;
+}
+
+namespace
+{
+    /** How long a search may run before it is stopped and its partial results returned */
+    constexpr double BlueprintSearchTimeoutSeconds = 10.0;
+
+    /** How long a search that is never polled again is kept before it is dropped with its results */
+    constexpr double AbandonedBlueprintSearchLifetimeSeconds = 600.0;
+
+    /** Blueprint > graph > node > pin; pins are summarized by their parent node */
+    constexpr int32 MaxSearchResultDepth = 3;
+
+    TSharedPtr<FJsonObject> SearchResultToJson(const FSearchResult& Result, int32 Depth)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("text"), Result->GetDisplayString().ToString());
+        const FString Category = Result->GetCategory().ToString();
+        if (!Category.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("category"), Category);
+        }
+
+        if (Result->Children.Num() > 0 && Depth < MaxSearchResultDepth)
+        {
+            TArray<TSharedPtr<FJsonValue>> Children;
+            for (const FSearchResult& Child : Result->Children)
+            {
+                Children.Add(MakeShared<FJsonValueObject>(SearchResultToJson(Child, Depth + 1)));
+            }
+            ResultObj->SetArrayField(TEXT("matches"), Children);
+        }
+        else if (Result->Children.Num() > 0)
+        {
+            ResultObj->SetNumberField(TEXT("match_count"), Result->Children.Num());
+        }
+        return ResultObj;
+    }
+
+    /** Report a search that is still running, or collect its results once it has finished or run out of time */
+    TSharedPtr<FJsonObject> BlueprintSearchToJson(FMCPBlueprintSearch& Search)
+    {
+        const double ElapsedSeconds = FPlatformTime::Seconds() - Search.StartTime;
+        const bool bComplete = Search.Search->IsComplete();
+        const bool bTimedOut = !bComplete && ElapsedSeconds > BlueprintSearchTimeoutSeconds;
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("search_id"), Search.Id);
+        ResultObj->SetStringField(TEXT("query"), Search.Query);
+        ResultObj->SetNumberField(TEXT("search_time_ms"), ElapsedSeconds * 1000.0);
+        if (!bComplete && !bTimedOut)
+        {
+            ResultObj->SetStringField(TEXT("state"), TEXT("running"));
+            return ResultObj;
+        }
+
+        TArray<FSearchResult> Results;
+        Search.Search->GetFilteredItems(Results);
+        if (bTimedOut)
+        {
+            Search.Search->Stop();
+        }
+        Search.Search->EnsureCompletion();
+        Search.Search.Reset();
+
+        TArray<TSharedPtr<FJsonValue>> BlueprintArray;
+        for (const FSearchResult& Result : Results)
+        {
+            if (BlueprintArray.Num() >= Search.MaxResults)
+            {
+                break;
+            }
+
+            TSharedPtr<FJsonObject> BlueprintObj = SearchResultToJson(Result, 1);
+            BlueprintObj->SetStringField(TEXT("path"), BlueprintObj->GetStringField(TEXT("text")));
+            BlueprintObj->RemoveField(TEXT("text"));
+            BlueprintArray.Add(MakeShared<FJsonValueObject>(BlueprintObj));
+        }
+
+        ResultObj->SetStringField(TEXT("state"), TEXT("completed"));
+        ResultObj->SetArrayField(TEXT("blueprints"), BlueprintArray);
+        ResultObj->SetNumberField(TEXT("blueprint_count"), Results.Num());
+        ResultObj->SetBoolField(TEXT("truncated"), Results.Num() > BlueprintArray.Num());
+        ResultObj->SetBoolField(TEXT("timed_out"), bTimedOut);
+        ResultObj->SetBoolField(TEXT("index_complete"), !FFindInBlueprintSearchManager::Get().IsCacheInProgress());
+        return ResultObj;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleLintBlueprint(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    // Find the blueprint
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::LintBlueprint(Blueprint);
     ResultObj->SetStringField(TEXT("name"), BlueprintName);
-    ResultObj->SetBoolField(TEXT("compiled"), true);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSearchBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    // Build a Find-in-Blueprints query from the raw query and/or the shorthand filters, all of which must match
+    TArray<FString> Terms;
+    FString Query;
+    if (Params->TryGetStringField(TEXT("query"), Query) && !Query.IsEmpty())
+    {
+        Terms.Add(Query);
+    }
+
+    FString FunctionName;
+    if (Params->TryGetStringField(TEXT("function_name"), FunctionName) && !FunctionName.IsEmpty())
+    {
+        Terms.Add(FString::Printf(TEXT("Nodes(NativeName=\"%s\")"), *FunctionName));
+    }
+
+    FString VariableName;
+    if (Params->TryGetStringField(TEXT("variable_name"), VariableName) && !VariableName.IsEmpty())
+    {
+        Terms.Add(FString::Printf(TEXT("Properties(Name=\"%s\")"), *VariableName));
+    }
+
+    if (Terms.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'query', 'function_name' or 'variable_name' parameter"));
+    }
+
+    int32 MaxResults = 50;
+    Params->TryGetNumberField(TEXT("max_results"), MaxResults);
+    MaxResults = FMath::Max(MaxResults, 1);
+
+    // The search runs over the search data the editor keeps for every blueprint: read from the asset registry
+    // for unloaded assets and refreshed when blueprints are compiled or saved, so no package is loaded here.
+    // It runs on its own thread, so the game thread only starts it here and collects it when polled
+    TSharedPtr<FMCPBlueprintSearch> Search = MakeShared<FMCPBlueprintSearch>();
+    Search->Id = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+    Search->Query = FString::Join(Terms, TEXT(" && "));
+    Search->Search = MakeShared<FStreamSearch>(Search->Query);
+    Search->MaxResults = MaxResults;
+    Search->StartTime = FPlatformTime::Seconds();
+
+    // Searches are normally removed when their results are fetched; drop the ones that were never polled to the end
+    const double Now = FPlatformTime::Seconds();
+    for (auto It = BlueprintSearches.CreateIterator(); It; ++It)
+    {
+        if (Now - It.Value()->StartTime > AbandonedBlueprintSearchLifetimeSeconds)
+        {
+            It.Value()->Search->Stop();
+            It.Value()->Search->EnsureCompletion();
+            It.RemoveCurrent();
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = BlueprintSearchToJson(*Search);
+    if (Search->Search.IsValid())
+    {
+        BlueprintSearches.Add(Search->Id, Search);
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetBlueprintSearch(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString SearchId;
+    if (!Params->TryGetStringField(TEXT("search_id"), SearchId))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'search_id' parameter"));
+    }
+
+    TSharedPtr<FMCPBlueprintSearch>* Search = BlueprintSearches.Find(SearchId);
+    if (!Search)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint search not found: %s"), *SearchId));
+    }
+
+    // Results are handed out once; a finished search is forgotten as soon as it has been reported
+    TSharedPtr<FJsonObject> ResultObj = BlueprintSearchToJson(**Search);
+    if (!(*Search)->Search.IsValid())
+    {
+        BlueprintSearches.Remove(SearchId);
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleFlushBlueprintCompiles(const TSharedPtr<FJsonObject>& Params)
+{
+    // Fully compile everything that was only skeleton-compiled and hasn't been compiled since, in one batch
+    TArray<UBlueprint*> Blueprints;
+    for (const TWeakObjectPtr<UBlueprint>& Blueprint : PendingFullCompiles)
+    {
+        if (Blueprint.IsValid() && !FUnrealMCPCommonUtils::IsBlueprintUpToDate(Blueprint.Get()))
+        {
+            Blueprints.Add(Blueprint.Get());
+        }
+    }
+    PendingFullCompiles.Reset();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("count"), Blueprints.Num());
+    ResultObj->SetArrayField(TEXT("results"), Blueprints.Num() > 0 ? FUnrealMCPCommonUtils::CompileBlueprints(Blueprints) : TArray<TSharedPtr<FJsonValue>>());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FMCPBlueprintCompileJob> Job = MakeShared<FMCPBlueprintCompileJob>();
+    Job->Id = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+
+    // Blueprints come from an explicit list of names, a content path filter, or both
+    const TArray<TSharedPtr<FJsonValue>>* NameArray = nullptr;
+    FString PackagePath;
+    const bool bHasNames = Params->TryGetArrayField(TEXT("blueprint_names"), NameArray);
+    const bool bHasPath = Params->TryGetStringField(TEXT("path"), PackagePath);
+    if (!bHasNames && !bHasPath)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_names' or 'path' parameter"));
+    }
+
+    if (bHasNames)
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *NameArray)
+        {
+            const FString BlueprintName = NameValue->AsString();
+            UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+            if (!Blueprint)
+            {
+                TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+                ResultObj->SetStringField(TEXT("name"), BlueprintName);
+                ResultObj->SetBoolField(TEXT("compiled"), false);
+                ResultObj->SetStringField(TEXT("error"), FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+                Job->Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+                continue;
+            }
+            Job->Pending.AddUnique(FSoftObjectPath(Blueprint));
+        }
+    }
+
+    if (bHasPath)
+    {
+        // Query the registry rather than loading the folder; blueprints are loaded batch by batch
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*PackagePath));
+        Filter.bRecursivePaths = true;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+
+        TArray<FAssetData> Assets;
+        AssetRegistryModule.Get().GetAssets(Filter, Assets);
+        for (const FAssetData& Asset : Assets)
+        {
+            Job->Pending.AddUnique(Asset.GetSoftObjectPath());
+        }
+    }
+
+    Params->TryGetBoolField(TEXT("dirty_only"), Job->bDirtyOnly);
+    Params->TryGetNumberField(TEXT("batch_size"), Job->BatchSize);
+    bool bBackground = false;
+    Params->TryGetBoolField(TEXT("background"), bBackground);
+
+    Job->Total = Job->Pending.Num() + Job->Results.Num();
+    Job->StartTime = FPlatformTime::Seconds();
+
+    if (!bBackground)
+    {
+        while (RunCompileJobBatch(*Job))
+        {
+        }
+        return CompileJobToJson(*Job);
+    }
+
+    // Compile one batch per editor tick so the command queue keeps running between batches
+    if (Job->BatchSize <= 0)
+    {
+        Job->BatchSize = 16;
+    }
+    if (Job->IsDone())
+    {
+        return CompileJobToJson(*Job);
+    }
+
+    // Completed jobs are normally removed when their results are fetched; drop the ones that never were
+    const double Now = FPlatformTime::Seconds();
+    for (auto It = CompileJobs.CreateIterator(); It; ++It)
+    {
+        if (It.Value()->IsDone() && Now - It.Value()->CompletedTime > CompletedCompileJobLifetimeSeconds)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    CompileJobs.Add(Job->Id, Job);
+    Job->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Job](float DeltaTime)
+    {
+        return RunCompileJobBatch(*Job);
+    }));
+
+    UE_LOG(LogTemp, Display, TEXT("Started compile job %s for %d blueprints"), *Job->Id, Job->Total);
+    return CompileJobToJson(*Job);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleGetCompileJob(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString JobId;
+    if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    TSharedPtr<FMCPBlueprintCompileJob>* Job = CompileJobs.Find(JobId);
+    if (!Job)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Compile job not found: %s"), *JobId));
+    }
+
+    // Results are handed out once; a completed job is forgotten as soon as it has been reported
+    TSharedPtr<FJsonObject> ResultObj = CompileJobToJson(**Job);
+    if ((*Job)->IsDone())
+    {
+        CompileJobs.Remove(JobId);
+    }
     return ResultObj;
 }
 
@@ -872,7 +1876,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSpawnBlueprintActor(c
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get transform parameters
@@ -928,7 +1932,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty(
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the default object
@@ -982,19 +1986,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetStaticMeshProperti
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Find the component
-    USCS_Node* ComponentNode = nullptr;
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node && Node->GetVariableName().ToString() == ComponentName)
-        {
-            ComponentNode = Node;
-            break;
-        }
-    }
+    USCS_Node* ComponentNode = FUnrealMCPCommonUtils::FindSCSNode(Blueprint->SimpleConstructionScript, FName(*ComponentName));
 
     if (!ComponentNode)
     {
@@ -1049,7 +2045,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleSetPawnProperties(con
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the default object
@@ -5,13 +5,20 @@
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraph/EdGraphPin.h"
+#include "K2Node.h"
 #include "K2Node_Event.h"
+#include "K2Node_CustomEvent.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_VariableGet.h"
+#include "K2Node_Variable.h"
 #include "K2Node_InputAction.h"
 #include "K2Node_Self.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/Kismet2NameValidators.h"
+#include "EdGraphUtilities.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "GameFramework/InputSettings.h"
 #include "Camera/CameraActor.h"
 #include "Kismet/GameplayStatics.h"
@@ -26,6 +33,28 @@ FUnrealMCPBlueprintNodeCommands::FUnrealMCPBlueprintNodeCommands()
 {
 }
 
+void FUnrealMCPBlueprintNodeCommands::AutoPlaceNode(UEdGraphNode* Node)
+{
+    if (FUnrealMCPCommonUtils::AutoPlaceNode(Node))
+    {
+        return;
+    }
+
+    // Drop graphs that were closed or collected since their nodes were placed
+    for (auto It = AutoPlacedNodes.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    if (UEdGraph* Graph = Node ? Node->GetGraph() : nullptr)
+    {
+        AutoPlacedNodes.FindOrAdd(Graph).Add(Node);
+    }
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
     if (CommandType == TEXT("connect_blueprint_nodes"))
@@ -48,6 +77,26 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleCommand(const FSt
     {
         return HandleAddBlueprintVariable(Params);
     }
+    else if (CommandType == TEXT("add_blueprint_variables"))
+    {
+        return HandleAddBlueprintVariables(Params);
+    }
+    else if (CommandType == TEXT("get_blueprint_graph"))
+    {
+        return HandleGetBlueprintGraph(Params);
+    }
+    else if (CommandType == TEXT("export_graph_nodes"))
+    {
+        return HandleExportGraphNodes(Params);
+    }
+    else if (CommandType == TEXT("import_graph_nodes"))
+    {
+        return HandleImportGraphNodes(Params);
+    }
+    else if (CommandType == TEXT("layout_graph"))
+    {
+        return HandleLayoutGraph(Params);
+    }
     else if (CommandType == TEXT("add_blueprint_input_action_node"))
     {
         return HandleAddBlueprintInputActionNode(Params);
@@ -101,7 +150,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintN
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the event graph
@@ -134,6 +183,23 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintN
     // Connect the nodes
     if (FUnrealMCPCommonUtils::ConnectGraphNodes(EventGraph, SourceNode, SourcePinName, TargetNode, TargetPinName))
     {
+        // A node placed before it had links moves next to the first node it gets connected to
+        if (TSet<TWeakObjectPtr<UEdGraphNode>>* Pending = AutoPlacedNodes.Find(EventGraph))
+        {
+            if (Pending->Remove(TargetNode) > 0)
+            {
+                FUnrealMCPCommonUtils::PlaceNextToLinkedNode(TargetNode);
+            }
+            else if (Pending->Remove(SourceNode) > 0)
+            {
+                FUnrealMCPCommonUtils::PlaceNextToLinkedNode(SourceNode);
+            }
+            if (Pending->Num() == 0)
+            {
+                AutoPlacedNodes.Remove(EventGraph);
+            }
+        }
+
         // Mark the blueprint as modified
         FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
@@ -167,12 +233,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSe
     {
         NodePosition = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("node_position"));
     }
+    const bool bAutoPlace = !Params->HasTypedField<EJson::Array>(TEXT("node_position"));
 
     // Find the blueprint
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the event graph
@@ -207,6 +274,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSe
     
     // Explicitly reconstruct node for UE5.5
     GetComponentNode->ReconstructNode();
+
+    if (bAutoPlace)
+    {
+        AutoPlaceNode(GetComponentNode);
+    }
     
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
@@ -237,12 +309,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent
     {
         NodePosition = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("node_position"));
     }
+    const bool bAutoPlace = !Params->HasTypedField<EJson::Array>(TEXT("node_position"));
 
     // Find the blueprint
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the event graph
@@ -259,6 +332,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create event node"));
     }
 
+    if (bAutoPlace)
+    {
+        AutoPlaceNode(EventNode);
+    }
+
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
@@ -288,6 +366,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     {
         NodePosition = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("node_position"));
     }
+    const bool bAutoPlace = !Params->HasTypedField<EJson::Array>(TEXT("node_position"));
 
     FString TargetName;
     Params->TryGetStringField(TEXT("target"), TargetName);
@@ -296,7 +375,7 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the event graph
@@ -317,15 +396,12 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
         // Attempt 1: Check if the target is a component within this Blueprint
         if (Blueprint->SimpleConstructionScript)
         {
-            for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+            USCS_Node* Node = FUnrealMCPCommonUtils::FindSCSNode(Blueprint->SimpleConstructionScript, FName(*TargetName));
+            if (Node && Node->ComponentTemplate)
             {
-                if (Node && Node->GetVariableName().ToString() == TargetName)
-                {
-                    TargetClass = Node->ComponentTemplate->GetClass();
-                    TargetObject = Node->ComponentTemplate;
-                    UE_LOG(LogTemp, Display, TEXT("HandleAddBlueprintFunctionCall: Found target as component instance: %s"), *TargetName);
-                    break;
-                }
+                TargetClass = Node->ComponentTemplate->GetClass();
+                TargetObject = Node->ComponentTemplate;
+                UE_LOG(LogTemp, Display, TEXT("HandleAddBlueprintFunctionCall: Found target as component instance: %s"), *TargetName);
             }
         }
 
@@ -384,6 +460,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunct
     FunctionNode->PostPlacedNewNode();
     FunctionNode->AllocateDefaultPins();
 
+    if (bAutoPlace)
+    {
+        // The target node below is placed relative to the function node
+        AutoPlaceNode(FunctionNode);
+        NodePosition = FVector2D(FunctionNode->NodePosX, FunctionNode->NodePosY);
+    }
+
     // If the function is not static, we must hook up the 'self' pin
     if (!bIsStaticFunction)
     {
@@ -508,37 +591,15 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVaria
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Create variable based on type
     FEdGraphPinType PinType;
-    
-    // Set up pin type based on variable_type string
-    if (VariableType == TEXT("Boolean"))
-    {
-        PinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-    }
-    else if (VariableType == TEXT("Integer") || VariableType == TEXT("Int"))
-    {
-        PinType.PinCategory = UEdGraphSchema_K2::PC_Int;
-    }
-    else if (VariableType == TEXT("Float"))
-    {
-        PinType.PinCategory = UEdGraphSchema_K2::PC_Float;
-    }
-    else if (VariableType == TEXT("String"))
-    {
-        PinType.PinCategory = UEdGraphSchema_K2::PC_String;
-    }
-    else if (VariableType == TEXT("Vector"))
+    FString ErrorMessage;
+    if (!FUnrealMCPCommonUtils::ParsePinType(MakeShared<FJsonValueString>(VariableType), PinType, ErrorMessage))
     {
-        PinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
-        PinType.PinSubCategoryObject = TBaseStructure<FVector>::Get();
-    }
-    else
-    {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unsupported variable type: %s"), *VariableType));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
     }
 
     // Create the variable
@@ -573,6 +634,211 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVaria
     return ResultObj;
 }
 
+namespace
+{
+    /** Convert a JSON default value to the text form stored in a variable description */
+    bool JsonToVariableDefault(const TSharedPtr<FJsonValue>& Value, const FEdGraphPinType& PinType, FString& OutDefault, FString& OutErrorMessage)
+    {
+        // Booleans and numbers also convert with TryGetString, so the JSON type is checked before the string case
+        FString StringValue;
+        const TArray<TSharedPtr<FJsonValue>>* ArrayValue = nullptr;
+        if (Value->Type == EJson::Boolean)
+        {
+            OutDefault = Value->AsBool() ? TEXT("true") : TEXT("false");
+        }
+        else if (Value->Type == EJson::Number)
+        {
+            const double NumberValue = Value->AsNumber();
+            OutDefault = PinType.PinCategory == UEdGraphSchema_K2::PC_Real ? FString::SanitizeFloat(NumberValue) : FString::Printf(TEXT("%lld"), static_cast<int64>(NumberValue));
+        }
+        else if (Value->TryGetString(StringValue))
+        {
+            OutDefault = StringValue;
+        }
+        else if (Value->TryGetArray(ArrayValue) && ArrayValue->Num() == 3 && !PinType.IsContainer() &&
+                 (PinType.PinSubCategoryObject == TBaseStructure<FVector>::Get() || PinType.PinSubCategoryObject == TBaseStructure<FRotator>::Get()))
+        {
+            const double X = (*ArrayValue)[0]->AsNumber();
+            const double Y = (*ArrayValue)[1]->AsNumber();
+            const double Z = (*ArrayValue)[2]->AsNumber();
+            OutDefault = PinType.PinSubCategoryObject == TBaseStructure<FVector>::Get()
+                ? FString::Printf(TEXT("(X=%f,Y=%f,Z=%f)"), X, Y, Z)
+                : FString::Printf(TEXT("(Pitch=%f,Yaw=%f,Roll=%f)"), X, Y, Z);
+        }
+        else
+        {
+            OutErrorMessage = TEXT("'default_value' must be a string in property text format, a number, a boolean or an [X, Y, Z] array");
+            return false;
+        }
+        return true;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVariables(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Variables = nullptr;
+    if (!Params->TryGetArrayField(TEXT("variables"), Variables))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'variables' parameter"));
+    }
+
+    // Find the blueprint
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+    }
+
+    // Descriptions are appended directly so the whole batch costs one structural modification instead of one per variable
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int32 AddedCount = 0;
+    Blueprint->Modify();
+    for (const TSharedPtr<FJsonValue>& VariableValue : *Variables)
+    {
+        const TSharedPtr<FJsonObject>* VariableSpecPtr = nullptr;
+        FString VariableName;
+        if (!VariableValue->TryGetObject(VariableSpecPtr) || !(*VariableSpecPtr)->TryGetStringField(TEXT("name"), VariableName))
+        {
+            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+            ResultObj->SetBoolField(TEXT("added"), false);
+            ResultObj->SetStringField(TEXT("error"), TEXT("Variable spec is missing 'name'"));
+            Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+            continue;
+        }
+        const TSharedPtr<FJsonObject>& VariableSpec = *VariableSpecPtr;
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), VariableName);
+        Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+        auto Fail = [&ResultObj](const FString& ErrorMessage)
+        {
+            ResultObj->SetBoolField(TEXT("added"), false);
+            ResultObj->SetStringField(TEXT("error"), ErrorMessage);
+        };
+
+        // Checks against variables, components, functions and the variables added earlier in this batch
+        const FName VarName(*VariableName);
+        if (FKismetNameValidator(Blueprint).IsValid(VarName) != EValidatorResult::Ok)
+        {
+            Fail(FString::Printf(TEXT("Name is invalid or already in use: %s"), *VariableName));
+            continue;
+        }
+
+        FEdGraphPinType PinType;
+        FString ErrorMessage;
+        if (!FUnrealMCPCommonUtils::ParsePinType(VariableSpec->TryGetField(TEXT("type")), PinType, ErrorMessage))
+        {
+            Fail(ErrorMessage);
+            continue;
+        }
+
+        FString DefaultValue;
+        TSharedPtr<FJsonValue> DefaultJson = VariableSpec->TryGetField(TEXT("default_value"));
+        if (DefaultJson.IsValid() && !JsonToVariableDefault(DefaultJson, PinType, DefaultValue, ErrorMessage))
+        {
+            Fail(ErrorMessage);
+            continue;
+        }
+
+        FBPVariableDescription Variable = FUnrealMCPCommonUtils::MakeVariableDescription(VarName, PinType, DefaultValue);
+
+        FString Category;
+        if (VariableSpec->TryGetStringField(TEXT("category"), Category) && !Category.IsEmpty())
+        {
+            Variable.Category = FText::FromString(Category);
+        }
+        FString Tooltip;
+        if (VariableSpec->TryGetStringField(TEXT("tooltip"), Tooltip))
+        {
+            Variable.SetMetaData(FBlueprintMetadata::MD_Tooltip, Tooltip);
+        }
+
+        bool bFlag = false;
+        if (VariableSpec->TryGetBoolField(TEXT("instance_editable"), bFlag) && bFlag)
+        {
+            Variable.PropertyFlags &= ~CPF_DisableEditOnInstance;
+        }
+        if (VariableSpec->TryGetBoolField(TEXT("read_only"), bFlag) && bFlag)
+        {
+            Variable.PropertyFlags |= CPF_BlueprintReadOnly;
+        }
+        if (VariableSpec->TryGetBoolField(TEXT("expose_on_spawn"), bFlag) && bFlag)
+        {
+            Variable.SetMetaData(FBlueprintMetadata::MD_ExposeOnSpawn, TEXT("true"));
+        }
+        if (VariableSpec->TryGetBoolField(TEXT("private"), bFlag) && bFlag)
+        {
+            Variable.SetMetaData(FBlueprintMetadata::MD_Private, TEXT("true"));
+        }
+
+        // Replication: "none", "replicated" or "rep_notify", with an optional lifetime condition
+        FString Replication;
+        if (VariableSpec->TryGetStringField(TEXT("replication"), Replication) && Replication != TEXT("none"))
+        {
+            if (Replication != TEXT("replicated") && Replication != TEXT("rep_notify"))
+            {
+                Fail(FString::Printf(TEXT("Unknown replication mode: %s"), *Replication));
+                continue;
+            }
+
+            Variable.PropertyFlags |= CPF_Net;
+            if (Replication == TEXT("rep_notify"))
+            {
+                Variable.PropertyFlags |= CPF_RepNotify;
+                Variable.RepNotifyFunc = FName(*(TEXT("OnRep_") + VariableName));
+            }
+
+            FString Condition;
+            if (VariableSpec->TryGetStringField(TEXT("replication_condition"), Condition))
+            {
+                const int64 ConditionValue = StaticEnum<ELifetimeCondition>()->GetValueByNameString(Condition);
+                if (ConditionValue == INDEX_NONE)
+                {
+                    Fail(FString::Printf(TEXT("Unknown replication condition: %s"), *Condition));
+                    continue;
+                }
+                Variable.ReplicationCondition = static_cast<ELifetimeCondition>(ConditionValue);
+            }
+        }
+
+        Blueprint->NewVariables.Add(Variable);
+        ++AddedCount;
+
+        // The editor creates the notify function along with a RepNotify variable; do the same if it doesn't exist yet
+        if (Variable.RepNotifyFunc != NAME_None && !FindObject<UEdGraph>(Blueprint, *Variable.RepNotifyFunc.ToString()))
+        {
+            // Add the graph directly rather than through AddFunctionGraph, which would mark the blueprint structurally
+            // modified once per variable; the batch is marked once below
+            UEdGraph* NotifyGraph = FBlueprintEditorUtils::CreateNewGraph(Blueprint, Variable.RepNotifyFunc, UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+            Blueprint->FunctionGraphs.Add(NotifyGraph);
+            const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+            K2Schema->CreateDefaultNodesForGraph(*NotifyGraph);
+            K2Schema->CreateFunctionGraphTerminators(*NotifyGraph, static_cast<UClass*>(nullptr));
+            ResultObj->SetStringField(TEXT("rep_notify_function"), Variable.RepNotifyFunc.ToString());
+        }
+
+        ResultObj->SetBoolField(TEXT("added"), true);
+    }
+
+    if (AddedCount > 0)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint"), BlueprintName);
+    ResultObj->SetNumberField(TEXT("added_count"), AddedCount);
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInputActionNode(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -594,12 +860,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInput
     {
         NodePosition = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("node_position"));
     }
+    const bool bAutoPlace = !Params->HasTypedField<EJson::Array>(TEXT("node_position"));
 
     // Find the blueprint
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the event graph
@@ -616,6 +883,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInput
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create input action node"));
     }
 
+    if (bAutoPlace)
+    {
+        AutoPlaceNode(InputActionNode);
+    }
+
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
@@ -639,12 +911,13 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
     {
         NodePosition = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("node_position"));
     }
+    const bool bAutoPlace = !Params->HasTypedField<EJson::Array>(TEXT("node_position"));
 
     // Find the blueprint
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get the event graph
@@ -661,6 +934,11 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create self node"));
     }
 
+    if (bAutoPlace)
+    {
+        AutoPlaceNode(SelfNode);
+    }
+
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
@@ -669,6 +947,45 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfR
     return ResultObj;
 }
 
+namespace
+{
+    /** Resolve a node class from "K2Node_CallFunction", "UK2Node_CallFunction" or just "CallFunction" */
+    UClass* FindNodeClass(const FString& ClassName)
+    {
+        TArray<FString> Candidates = { ClassName, TEXT("K2Node_") + ClassName };
+        if (ClassName.StartsWith(TEXT("U")))
+        {
+            Candidates.Add(ClassName.Mid(1));
+        }
+
+        for (const FString& Candidate : Candidates)
+        {
+            UClass* NodeClass = FindFirstObject<UClass>(*Candidate, EFindFirstObjectOptions::NativeFirst);
+            if (NodeClass && NodeClass->IsChildOf(UEdGraphNode::StaticClass()))
+            {
+                return NodeClass;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Whether a node has a visible pin of the given kind ("exec_input", "exec_output", "data_input" or "data_output") with no links */
+    bool HasUnconnectedPin(const UEdGraphNode* Node, const FString& PinKind)
+    {
+        const bool bExec = PinKind.StartsWith(TEXT("exec"));
+        const EEdGraphPinDirection Direction = PinKind.EndsWith(TEXT("input")) ? EGPD_Input : EGPD_Output;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin->bHidden && Pin->Direction == Direction && Pin->LinkedTo.Num() == 0 &&
+                (Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec) == bExec)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNodes(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -678,53 +995,558 @@ TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNode
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
     }
 
-    FString NodeType;
-    if (!Params->TryGetStringField(TEXT("node_type"), NodeType))
+    // Get optional filters; every filter given must match
+    FString NodeType, NodeClassName, FunctionName, VariableName, EventName, GraphName, CommentText, TitleText, UnconnectedPin;
+    Params->TryGetStringField(TEXT("node_type"), NodeType);
+    Params->TryGetStringField(TEXT("node_class"), NodeClassName);
+    Params->TryGetStringField(TEXT("function_name"), FunctionName);
+    Params->TryGetStringField(TEXT("variable_name"), VariableName);
+    if (!Params->TryGetStringField(TEXT("event_name"), EventName))
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'node_type' parameter"));
+        Params->TryGetStringField(TEXT("event_type"), EventName);
     }
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+    Params->TryGetStringField(TEXT("comment"), CommentText);
+    Params->TryGetStringField(TEXT("title"), TitleText);
+    Params->TryGetStringField(TEXT("unconnected_pin"), UnconnectedPin);
+
+    bool bIncludePins = false;
+    Params->TryGetBoolField(TEXT("include_pins"), bIncludePins);
+    int32 Limit = 100;
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Limit = FMath::Max(Limit, 1);
 
     // Find the blueprint
     UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
-    // Get the event graph
-    UEdGraph* EventGraph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
+    // node_type is shorthand for the common node classes
+    static const TMap<FString, FString> NodeTypeClasses = {
+        { TEXT("Event"), TEXT("K2Node_Event") },
+        { TEXT("Function"), TEXT("K2Node_CallFunction") },
+        { TEXT("Variable"), TEXT("K2Node_Variable") },
+        { TEXT("InputAction"), TEXT("K2Node_InputAction") },
+        { TEXT("Self"), TEXT("K2Node_Self") }
+    };
+    if (!NodeType.IsEmpty())
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get event graph"));
+        const FString* TypeClassName = NodeTypeClasses.Find(NodeType);
+        if (!TypeClassName)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown node_type: %s (expected Event, Function, Variable, InputAction or Self)"), *NodeType));
+        }
+        if (NodeClassName.IsEmpty())
+        {
+            NodeClassName = *TypeClassName;
+        }
+    }
+
+    FName NodeClassFName = NAME_None;
+    if (!NodeClassName.IsEmpty())
+    {
+        UClass* NodeClass = FindNodeClass(NodeClassName);
+        if (!NodeClass)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown node class: %s"), *NodeClassName));
+        }
+        NodeClassFName = NodeClass->GetFName();
+    }
+
+    if (!UnconnectedPin.IsEmpty() && UnconnectedPin != TEXT("exec_input") && UnconnectedPin != TEXT("exec_output") &&
+        UnconnectedPin != TEXT("data_input") && UnconnectedPin != TEXT("data_output"))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'unconnected_pin' must be exec_input, exec_output, data_input or data_output"));
+    }
+
+    // The member filters are served by the node index; the remaining filters are checked on its results
+    const FString MemberName = !FunctionName.IsEmpty() ? FunctionName : !EventName.IsEmpty() ? EventName : VariableName;
+    TArray<UEdGraphNode*> Candidates = FUnrealMCPCommonUtils::FindNodes(Blueprint, NodeClassFName, MemberName.IsEmpty() ? NAME_None : FName(*MemberName));
+    if (Candidates.Num() == 0 && MemberName == EventName && !EventName.IsEmpty() && !EventName.StartsWith(TEXT("Receive")))
+    {
+        // Native events are named ReceiveBeginPlay, ReceiveTick, ... while the editor shows them as BeginPlay, Tick, ...
+        EventName = TEXT("Receive") + EventName;
+        Candidates = FUnrealMCPCommonUtils::FindNodes(Blueprint, NodeClassFName, FName(*EventName));
     }
 
-    // Create a JSON array for the node GUIDs
     TArray<TSharedPtr<FJsonValue>> NodeGuidArray;
-    
-    // Filter nodes by the exact requested type
-    if (NodeType == TEXT("Event"))
+    TArray<TSharedPtr<FJsonValue>> NodeArray;
+    int32 MatchCount = 0;
+    for (UEdGraphNode* Node : Candidates)
     {
-        FString EventName;
-        if (!Params->TryGetStringField(TEXT("event_name"), EventName))
+        UEdGraph* Graph = Node->GetGraph();
+        if (!Graph || (!GraphName.IsEmpty() && Graph->GetName() != GraphName))
         {
-            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'event_name' parameter for Event node search"));
+            continue;
         }
-        
-        // Look for nodes with exact event name (e.g., ReceiveBeginPlay)
-        for (UEdGraphNode* Node : EventGraph->Nodes)
+
+        const FName NodeMember = FUnrealMCPCommonUtils::GetNodeMemberName(Node);
+        const bool bIsVariableNode = Node->IsA<UK2Node_Variable>();
+        if ((!FunctionName.IsEmpty() && (bIsVariableNode || NodeMember != FName(*FunctionName))) ||
+            (!EventName.IsEmpty() && (!Node->IsA<UK2Node_Event>() || NodeMember != FName(*EventName))) ||
+            (!VariableName.IsEmpty() && (!bIsVariableNode || NodeMember != FName(*VariableName))))
+        {
+            continue;
+        }
+        if (!CommentText.IsEmpty() && !Node->NodeComment.Contains(CommentText))
+        {
+            continue;
+        }
+        const FString Title = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+        if (!TitleText.IsEmpty() && !Title.Contains(TitleText))
+        {
+            continue;
+        }
+        if (!UnconnectedPin.IsEmpty() && !HasUnconnectedPin(Node, UnconnectedPin))
+        {
+            continue;
+        }
+
+        ++MatchCount;
+        if (NodeArray.Num() >= Limit)
+        {
+            continue;
+        }
+
+        NodeGuidArray.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString()));
+
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("id"), Node->NodeGuid.ToString());
+        NodeObj->SetStringField(TEXT("graph"), Graph->GetName());
+        NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+        NodeObj->SetStringField(TEXT("title"), Title);
+        TArray<TSharedPtr<FJsonValue>> Position;
+        Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosX));
+        Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosY));
+        NodeObj->SetArrayField(TEXT("position"), Position);
+
+        if (bIncludePins)
         {
-            UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-            if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
+            TArray<TSharedPtr<FJsonValue>> PinArray;
+            for (const UEdGraphPin* Pin : Node->Pins)
             {
-                UE_LOG(LogTemp, Display, TEXT("Found event node with name %s: %s"), *EventName, *EventNode->NodeGuid.ToString());
-                NodeGuidArray.Add(MakeShared<FJsonValueString>(EventNode->NodeGuid.ToString()));
+                if (Pin->bHidden)
+                {
+                    continue;
+                }
+
+                TSharedPtr<FJsonObject> PinObj = MakeShared<FJsonObject>();
+                PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
+                PinObj->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("input") : TEXT("output"));
+                PinObj->SetStringField(TEXT("category"), Pin->PinType.PinCategory.ToString());
+                PinObj->SetNumberField(TEXT("link_count"), Pin->LinkedTo.Num());
+                PinArray.Add(MakeShared<FJsonValueObject>(PinObj));
             }
+            NodeObj->SetArrayField(TEXT("pins"), PinArray);
         }
+
+        NodeArray.Add(MakeShared<FJsonValueObject>(NodeObj));
     }
-    // Add other node types as needed (InputAction, etc.)
-    
+
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("node_guids"), NodeGuidArray);
-    
+    ResultObj->SetArrayField(TEXT("nodes"), NodeArray);
+    ResultObj->SetNumberField(TEXT("match_count"), MatchCount);
+    ResultObj->SetBoolField(TEXT("truncated"), MatchCount > NodeArray.Num());
     return ResultObj;
-} 
\ No newline at end of file
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleGetBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    // Get optional parameters
+    FString GraphName;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+
+    int32 Offset = 0;
+    int32 Limit = 500;
+    Params->TryGetNumberField(TEXT("offset"), Offset);
+    Params->TryGetNumberField(TEXT("limit"), Limit);
+    Offset = FMath::Max(Offset, 0);
+    Limit = FMath::Max(Limit, 1);
+
+    // Find the blueprint
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+    }
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    if (!GraphName.IsEmpty())
+    {
+        Graphs.RemoveAll([&GraphName](const UEdGraph* Graph) { return !Graph || Graph->GetName() != GraphName; });
+        if (Graphs.Num() == 0)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+        }
+    }
+
+    // Nodes are paged across graphs in order; every graph is listed with its node count so callers can see the whole shape
+    TArray<TSharedPtr<FJsonValue>> GraphArray;
+    int32 TotalNodes = 0;
+    int32 ReturnedNodes = 0;
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>> GraphNodes = FUnrealMCPCommonUtils::GetGraphNodesJson(Graph);
+        const int32 FirstNode = FMath::Clamp(Offset - TotalNodes, 0, GraphNodes.Num());
+        const int32 NodeCount = FMath::Clamp(Limit - ReturnedNodes, 0, GraphNodes.Num() - FirstNode);
+        TotalNodes += GraphNodes.Num();
+        ReturnedNodes += NodeCount;
+
+        FString GraphType = TEXT("subgraph");
+        if (Blueprint->UbergraphPages.Contains(Graph))
+        {
+            GraphType = TEXT("event");
+        }
+        else if (Blueprint->FunctionGraphs.Contains(Graph))
+        {
+            GraphType = TEXT("function");
+        }
+        else if (Blueprint->MacroGraphs.Contains(Graph))
+        {
+            GraphType = TEXT("macro");
+        }
+        else if (Blueprint->DelegateSignatureGraphs.Contains(Graph))
+        {
+            GraphType = TEXT("delegate");
+        }
+
+        TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+        GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+        GraphObj->SetStringField(TEXT("type"), GraphType);
+        GraphObj->SetNumberField(TEXT("node_count"), GraphNodes.Num());
+        GraphObj->SetArrayField(TEXT("nodes"), TArray<TSharedPtr<FJsonValue>>(GraphNodes.GetData() + FirstNode, NodeCount));
+        GraphArray.Add(MakeShared<FJsonValueObject>(GraphObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint"), BlueprintName);
+    ResultObj->SetArrayField(TEXT("graphs"), GraphArray);
+    ResultObj->SetNumberField(TEXT("total_nodes"), TotalNodes);
+    ResultObj->SetNumberField(TEXT("offset"), Offset);
+    ResultObj->SetNumberField(TEXT("returned_nodes"), ReturnedNodes);
+    if (Offset + ReturnedNodes < TotalNodes)
+    {
+        ResultObj->SetNumberField(TEXT("next_offset"), Offset + ReturnedNodes);
+    }
+    return ResultObj;
+}
+
+namespace
+{
+    /**
+     * Resolve a snippet file for graph export and import. Only files under the project's Saved directory can be used,
+     * so socket clients can't read or write elsewhere on the machine; relative paths are relative to that directory.
+     */
+    bool ResolveSnippetFilePath(const FString& FilePath, FString& OutFullPath, FString& OutErrorMessage)
+    {
+        const FString SavedDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir());
+        OutFullPath = FPaths::ConvertRelativePathToFull(SavedDir, FilePath);
+        FPaths::NormalizeFilename(OutFullPath);
+        if (!FPaths::CollapseRelativeDirectories(OutFullPath) || !FPaths::IsUnderDirectory(OutFullPath, SavedDir))
+        {
+            OutErrorMessage = FString::Printf(TEXT("file_path must be inside the project's Saved directory: %s"), *FilePath);
+            return false;
+        }
+        return true;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleExportGraphNodes(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    // Get optional parameters
+    FString GraphName;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+    FString FilePath;
+    if (Params->TryGetStringField(TEXT("file_path"), FilePath))
+    {
+        FString ErrorMessage;
+        if (!ResolveSnippetFilePath(FilePath, FilePath, ErrorMessage))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+        }
+    }
+
+    // Find the blueprint and graph
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+    }
+
+    // Exporting only reads the blueprint, so a missing event graph is not created
+    UEdGraph* Graph = FUnrealMCPCommonUtils::FindExistingGraph(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    // Export the listed nodes, or the whole graph when none are listed
+    TSet<FString> NodeIds;
+    const TArray<TSharedPtr<FJsonValue>>* NodeIdArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("node_ids"), NodeIdArray))
+    {
+        for (const TSharedPtr<FJsonValue>& NodeIdValue : *NodeIdArray)
+        {
+            NodeIds.Add(NodeIdValue->AsString());
+        }
+    }
+
+    TSet<UObject*> NodesToExport;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node && Node->CanDuplicateNode() && (NodeIds.Num() == 0 || NodeIds.Contains(Node->NodeGuid.ToString())))
+        {
+            Node->PrepareForCopying();
+            NodesToExport.Add(Node);
+        }
+    }
+
+    if (NodesToExport.Num() == 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No exportable nodes found"));
+    }
+
+    // Same text format as the editor's copy/paste clipboard. Nodes are restored after export, as the editor's copy does.
+    FString ExportedText;
+    FEdGraphUtilities::ExportNodesToText(NodesToExport, ExportedText);
+    for (UObject* Node : NodesToExport)
+    {
+        if (UK2Node* K2Node = Cast<UK2Node>(Node))
+        {
+            K2Node->PostCopyNode();
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetNumberField(TEXT("node_count"), NodesToExport.Num());
+    if (!FilePath.IsEmpty())
+    {
+        if (!FFileHelper::SaveStringToFile(ExportedText, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to write file: %s"), *FilePath));
+        }
+        ResultObj->SetStringField(TEXT("file_path"), FilePath);
+    }
+    else
+    {
+        ResultObj->SetStringField(TEXT("text"), ExportedText);
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleImportGraphNodes(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    FString Text;
+    FString FilePath;
+    if (Params->TryGetStringField(TEXT("file_path"), FilePath))
+    {
+        FString ErrorMessage;
+        if (!ResolveSnippetFilePath(FilePath, FilePath, ErrorMessage))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+        }
+        if (!FFileHelper::LoadFileToString(Text, *FilePath))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to read file: %s"), *FilePath));
+        }
+    }
+    else if (!Params->TryGetStringField(TEXT("text"), Text))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'text' or 'file_path' parameter"));
+    }
+
+    // Get optional parameters
+    FString GraphName;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+
+    // Added to the positions stored in the text
+    const FVector2D Offset = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("offset"));
+
+    bool bRegenerateGuids = true;
+    Params->TryGetBoolField(TEXT("regenerate_guids"), bRegenerateGuids);
+
+    // Find the blueprint and graph
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+    }
+
+    UEdGraph* Graph = FUnrealMCPCommonUtils::FindGraph(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    if (!FEdGraphUtilities::CanImportNodesFromText(Graph, Text))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Text contains no nodes that can be placed in graph %s"), *Graph->GetName()));
+    }
+
+    // What the pasted nodes may clash with: node GUIDs, implemented events and custom event names across the blueprint
+    TSet<FGuid> ExistingGuids;
+    TSet<FName> ExistingEvents;
+    TSet<FName> ExistingCustomEvents;
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+    for (UEdGraph* ExistingGraph : AllGraphs)
+    {
+        for (UEdGraphNode* Node : ExistingGraph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+            ExistingGuids.Add(Node->NodeGuid);
+            if (const UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
+            {
+                ExistingCustomEvents.Add(CustomEvent->CustomFunctionName);
+            }
+            else if (const UK2Node_Event* Event = Cast<UK2Node_Event>(Node))
+            {
+                ExistingEvents.Add(Event->GetFunctionName());
+            }
+        }
+    }
+
+    // Paste the way the blueprint editor does. ImportNodesFromText already runs FEdGraphUtilities::PostProcessPastedNodes,
+    // which calls PostPasteNode on every node and fixes up links between them; the rest follows FBlueprintEditor::PasteNodesHere.
+    Graph->Modify();
+    TSet<UEdGraphNode*> ImportedNodes;
+    FEdGraphUtilities::ImportNodesFromText(Graph, Text, ImportedNodes);
+
+    TArray<TSharedPtr<FJsonValue>> NodeArray;
+    for (UEdGraphNode* Node : ImportedNodes)
+    {
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("source_id"), Node->NodeGuid.ToString());
+
+        // Kept GUIDs must still be unique within the blueprint
+        if (bRegenerateGuids || ExistingGuids.Contains(Node->NodeGuid))
+        {
+            Node->CreateNewGuid();
+            NodeObj->SetBoolField(TEXT("guid_regenerated"), true);
+        }
+        ExistingGuids.Add(Node->NodeGuid);
+        Node->NodePosX += FMath::RoundToInt(Offset.X);
+        Node->NodePosY += FMath::RoundToInt(Offset.Y);
+
+        // A custom event gets a free name close to its own. A second implementation of an event is disabled, as the
+        // editor does on paste, so the pasted chain is kept without breaking the compile.
+        if (UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
+        {
+            if (ExistingCustomEvents.Contains(CustomEvent->CustomFunctionName))
+            {
+                const FName PastedName = CustomEvent->CustomFunctionName;
+                CustomEvent->RenameCustomEventCloseToName();
+                NodeObj->SetStringField(TEXT("renamed_from"), PastedName.ToString());
+            }
+            ExistingCustomEvents.Add(CustomEvent->CustomFunctionName);
+        }
+        else if (UK2Node_Event* Event = Cast<UK2Node_Event>(Node))
+        {
+            bool bAlreadyImplemented = false;
+            ExistingEvents.Add(Event->GetFunctionName(), &bAlreadyImplemented);
+            if (bAlreadyImplemented)
+            {
+                Event->SetEnabledState(ENodeEnabledState::Disabled, false);
+                Event->NodeComment = TEXT("This event is already implemented in the blueprint, so this copy is disabled.");
+                Event->bCommentBubbleVisible = true;
+                NodeObj->SetBoolField(TEXT("disabled"), true);
+            }
+        }
+
+        // Refresh pins against the current signatures of the functions, variables and events the nodes refer to
+        Node->ReconstructNode();
+
+        NodeObj->SetStringField(TEXT("node_id"), Node->NodeGuid.ToString());
+        NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+        NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+        NodeArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+    }
+
+    if (ImportedNodes.Num() > 0)
+    {
+        Graph->NotifyGraphChanged();
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetNumberField(TEXT("imported_count"), ImportedNodes.Num());
+    ResultObj->SetArrayField(TEXT("nodes"), NodeArray);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleLayoutGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    // Get optional parameters
+    FString GraphName;
+    Params->TryGetStringField(TEXT("graph_name"), GraphName);
+
+    FVector2D Spacing(80.0f, 40.0f);
+    if (Params->HasTypedField<EJson::Array>(TEXT("spacing")))
+    {
+        Spacing = FUnrealMCPCommonUtils::GetVector2DFromJson(Params, TEXT("spacing"));
+    }
+
+    // Find the blueprint and graph
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
+    }
+
+    UEdGraph* Graph = FUnrealMCPCommonUtils::FindGraph(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    // Node positions don't affect the generated class, so this is not a structural change
+    Graph->Modify();
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::LayoutGraph(Graph, Spacing);
+    AutoPlacedNodes.Remove(Graph);
+    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    return ResultObj;
+}
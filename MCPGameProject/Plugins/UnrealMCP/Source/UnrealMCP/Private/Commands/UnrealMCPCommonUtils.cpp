@@ -10,8 +10,17 @@
 #include "K2Node_VariableSet.h"
 #include "K2Node_InputAction.h"
 #include "K2Node_Self.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_Tunnel.h"
 #include "EdGraphSchema_K2.h"
+#include "EdGraphNode_Comment.h"
+#include "Algo/StableSort.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "BlueprintCompilationManager.h"
+#include "Logging/TokenizedMessage.h"
+#include "Serialization/ArchiveObjectCrc32.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/LightComponent.h"
 #include "Components/PrimitiveComponent.h"
@@ -21,10 +30,20 @@
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "Editor.h"
+#include "Containers/Ticker.h"
+#include "Misc/PackageName.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "HAL/PlatformFileManager.h"
+#include "UObject/SavePackage.h"
 #include "BlueprintNodeSpawner.h"
 #include "BlueprintActionDatabase.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "Async/Async.h"
 
 // JSON Utilities
 TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::CreateErrorResponse(const FString& Message)
@@ -180,531 +199,3755 @@ UEdGraph* FUnrealMCPCommonUtils::FindOrCreateEventGraph(UBlueprint* Blueprint)
     return NewGraph;
 }
 
-// Blueprint node utilities
-UK2Node_Event* FUnrealMCPCommonUtils::CreateEventNode(UEdGraph* Graph, const FString& EventName, const FVector2D& Position)
+UEdGraph* FUnrealMCPCommonUtils::FindGraph(UBlueprint* Blueprint, const FString& GraphName)
 {
-    if (!Graph)
+    if (Blueprint && GraphName.IsEmpty())
     {
-        return nullptr;
+        return FindOrCreateEventGraph(Blueprint);
     }
-    
-    UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
+    return FindExistingGraph(Blueprint, GraphName);
+}
+
+UEdGraph* FUnrealMCPCommonUtils::FindExistingGraph(UBlueprint* Blueprint, const FString& GraphName)
+{
     if (!Blueprint)
     {
         return nullptr;
     }
-    
-    // Check for existing event node with this exact name
-    for (UEdGraphNode* Node : Graph->Nodes)
+
+    if (GraphName.IsEmpty())
     {
-        UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-        if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
+        for (UEdGraph* Graph : Blueprint->UbergraphPages)
         {
-            UE_LOG(LogTemp, Display, TEXT("Using existing event node with name %s (ID: %s)"), 
-                *EventName, *EventNode->NodeGuid.ToString());
-            return EventNode;
+            if (Graph && Graph->GetName().Contains(TEXT("EventGraph")))
+            {
+                return Graph;
+            }
         }
+        return nullptr;
     }
 
-    // No existing node found, create a new one
-    UK2Node_Event* EventNode = nullptr;
-    
-    // Find the function to create the event
-    UClass* BlueprintClass = Blueprint->GeneratedClass;
-    UFunction* EventFunction = BlueprintClass->FindFunctionByName(FName(*EventName));
-    
-    if (EventFunction)
-    {
-        EventNode = NewObject<UK2Node_Event>(Graph);
-        EventNode->EventReference.SetExternalMember(FName(*EventName), BlueprintClass);
-        EventNode->NodePosX = Position.X;
-        EventNode->NodePosY = Position.Y;
-        Graph->AddNode(EventNode, true);
-        EventNode->PostPlacedNewNode();
-        EventNode->AllocateDefaultPins();
-        UE_LOG(LogTemp, Display, TEXT("Created new event node with name %s (ID: %s)"), 
-            *EventName, *EventNode->NodeGuid.ToString());
-    }
-    else
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to find function for event name: %s"), *EventName);
+        if (Graph && Graph->GetName() == GraphName)
+        {
+            return Graph;
+        }
     }
-    
-    return EventNode;
+    return nullptr;
 }
 
-UK2Node_CallFunction* FUnrealMCPCommonUtils::CreateFunctionCallNode(UEdGraph* Graph, UFunction* Function, const FVector2D& Position)
+// Blueprint compile utilities
+namespace
 {
-    if (!Graph || !Function)
+    /** Outcome of the last compile of a blueprint, and the content it was compiled from */
+    struct FMCPBlueprintCompileState
     {
-        return nullptr;
+        uint32 ContentHash = 0;
+        EBlueprintStatus Status = BS_Unknown;
+        int32 NumErrors = 0;
+        int32 NumWarnings = 0;
+        double CompileTimeMs = 0.0;
+        TArray<TSharedPtr<FJsonValue>> Messages;
+    };
+
+    TMap<TWeakObjectPtr<UBlueprint>, FMCPBlueprintCompileState> BlueprintCompileStates;
+
+    FString BlueprintStatusToString(EBlueprintStatus Status)
+    {
+        switch (Status)
+        {
+            case BS_Dirty: return TEXT("Dirty");
+            case BS_Error: return TEXT("Error");
+            case BS_UpToDate: return TEXT("UpToDate");
+            case BS_BeingCreated: return TEXT("BeingCreated");
+            case BS_UpToDateWithWarnings: return TEXT("UpToDateWithWarnings");
+            default: return TEXT("Unknown");
+        }
     }
-    
-    UK2Node_CallFunction* FunctionNode = NewObject<UK2Node_CallFunction>(Graph);
-    FunctionNode->SetFromFunction(Function);
-    FunctionNode->NodePosX = Position.X;
-    FunctionNode->NodePosY = Position.Y;
-    Graph->AddNode(FunctionNode, true);
-    FunctionNode->CreateNewGuid();
-    FunctionNode->PostPlacedNewNode();
-    FunctionNode->AllocateDefaultPins();
-    
-    return FunctionNode;
-}
 
-UK2Node_VariableGet* FUnrealMCPCommonUtils::CreateVariableGetNode(UEdGraph* Graph, UBlueprint* Blueprint, const FString& VariableName, const FVector2D& Position)
-{
-    if (!Graph || !Blueprint)
+    TSharedPtr<FJsonObject> CompilerMessageToJson(const FTokenizedMessage& Message)
     {
-        return nullptr;
+        const EMessageSeverity::Type Severity = Message.GetSeverity();
+        TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+        MessageObj->SetStringField(TEXT("severity"),
+            Severity == EMessageSeverity::Error ? TEXT("error") :
+            Severity == EMessageSeverity::Warning || Severity == EMessageSeverity::PerformanceWarning ? TEXT("warning") :
+            TEXT("info"));
+        MessageObj->SetStringField(TEXT("message"), Message.ToText().ToString());
+        return MessageObj;
     }
-    
-    UK2Node_VariableGet* VariableGetNode = NewObject<UK2Node_VariableGet>(Graph);
-    
-    FName VarName(*VariableName);
-    FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
-    
-    if (Property)
+
+    TSharedPtr<FJsonObject> NodeMessageToJson(const FString& Severity, const FString& Message, const UEdGraph* Graph, const UEdGraphNode* Node)
     {
-        VariableGetNode->VariableReference.SetFromField<FProperty>(Property, false);
-        VariableGetNode->NodePosX = Position.X;
-        VariableGetNode->NodePosY = Position.Y;
-        Graph->AddNode(VariableGetNode, true);
-        VariableGetNode->PostPlacedNewNode();
-        VariableGetNode->AllocateDefaultPins();
-        
-        return VariableGetNode;
+        TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+        MessageObj->SetStringField(TEXT("severity"), Severity);
+        MessageObj->SetStringField(TEXT("message"), Message);
+        MessageObj->SetStringField(TEXT("graph"), Graph->GetName());
+        MessageObj->SetStringField(TEXT("node_id"), Node->NodeGuid.ToString());
+        MessageObj->SetStringField(TEXT("node_title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+        return MessageObj;
     }
-    
-    return nullptr;
-}
 
-UK2Node_VariableSet* FUnrealMCPCommonUtils::CreateVariableSetNode(UEdGraph* Graph, UBlueprint* Blueprint, const FString& VariableName, const FVector2D& Position)
-{
-    if (!Graph || !Blueprint)
+    /** GetTypeHash on strings and names ignores case, so a case-only edit would look unchanged */
+    uint32 HashString(uint32 Hash, const FString& String)
     {
-        return nullptr;
+        return FCrc::StrCrc32(*String, Hash);
     }
-    
-    UK2Node_VariableSet* VariableSetNode = NewObject<UK2Node_VariableSet>(Graph);
-    
-    FName VarName(*VariableName);
-    FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
-    
-    if (Property)
+
+    uint32 HashName(uint32 Hash, const FName& Name)
     {
-        VariableSetNode->VariableReference.SetFromField<FProperty>(Property, false);
-        VariableSetNode->NodePosX = Position.X;
-        VariableSetNode->NodePosY = Position.Y;
-        Graph->AddNode(VariableSetNode, true);
-        VariableSetNode->PostPlacedNewNode();
-        VariableSetNode->AllocateDefaultPins();
-        
-        return VariableSetNode;
+        return HashString(Hash, Name.ToString());
     }
-    
-    return nullptr;
-}
 
-UK2Node_InputAction* FUnrealMCPCommonUtils::CreateInputActionNode(UEdGraph* Graph, const FString& ActionName, const FVector2D& Position)
-{
-    if (!Graph)
+    uint32 HashPinType(uint32 Hash, const FEdGraphPinType& PinType)
     {
-        return nullptr;
+        Hash = HashName(Hash, PinType.PinCategory);
+        Hash = HashName(Hash, PinType.PinSubCategory);
+        Hash = HashCombine(Hash, GetTypeHash(PinType.PinSubCategoryObject.Get()));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(PinType.ContainerType)));
+        Hash = HashCombine(Hash, GetTypeHash(PinType.bIsReference) ^ (GetTypeHash(PinType.bIsConst) << 1) ^ (GetTypeHash(PinType.bIsWeakPointer) << 2));
+
+        // Map values have their own terminal type
+        const FEdGraphTerminalType& ValueType = PinType.PinValueType;
+        Hash = HashName(Hash, ValueType.TerminalCategory);
+        Hash = HashName(Hash, ValueType.TerminalSubCategory);
+        Hash = HashCombine(Hash, GetTypeHash(ValueType.TerminalSubCategoryObject.Get()));
+        Hash = HashCombine(Hash, GetTypeHash(ValueType.bTerminalIsConst) ^ (GetTypeHash(ValueType.bTerminalIsWeakPointer) << 1));
+        return Hash;
     }
-    
-    UK2Node_InputAction* InputActionNode = NewObject<UK2Node_InputAction>(Graph);
-    InputActionNode->InputActionName = FName(*ActionName);
-    InputActionNode->NodePosX = Position.X;
-    InputActionNode->NodePosY = Position.Y;
-    Graph->AddNode(InputActionNode, true);
-    InputActionNode->CreateNewGuid();
-    InputActionNode->PostPlacedNewNode();
-    InputActionNode->AllocateDefaultPins();
-    
-    return InputActionNode;
-}
 
-UK2Node_Self* FUnrealMCPCommonUtils::CreateSelfReferenceNode(UEdGraph* Graph, const FVector2D& Position)
-{
-    if (!Graph)
+    TSharedPtr<FJsonObject> CompileStateToJson(UBlueprint* Blueprint, const FMCPBlueprintCompileState& State, bool bSkipped)
     {
-        return nullptr;
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), Blueprint->GetName());
+        ResultObj->SetBoolField(TEXT("compiled"), State.Status != BS_Error);
+        ResultObj->SetBoolField(TEXT("skipped"), bSkipped);
+        ResultObj->SetStringField(TEXT("status"), BlueprintStatusToString(State.Status));
+        ResultObj->SetNumberField(TEXT("error_count"), State.NumErrors);
+        ResultObj->SetNumberField(TEXT("warning_count"), State.NumWarnings);
+        ResultObj->SetNumberField(TEXT("compile_time_ms"), State.CompileTimeMs);
+        ResultObj->SetArrayField(TEXT("messages"), State.Messages);
+        return ResultObj;
     }
-    
-    UK2Node_Self* SelfNode = NewObject<UK2Node_Self>(Graph);
-    SelfNode->NodePosX = Position.X;
-    SelfNode->NodePosY = Position.Y;
-    Graph->AddNode(SelfNode, true);
-    SelfNode->CreateNewGuid();
-    SelfNode->PostPlacedNewNode();
-    SelfNode->AllocateDefaultPins();
-    
-    return SelfNode;
 }
 
-bool FUnrealMCPCommonUtils::ConnectGraphNodes(UEdGraph* Graph, UEdGraphNode* SourceNode, const FString& SourcePinName, 
-                                           UEdGraphNode* TargetNode, const FString& TargetPinName)
+uint32 FUnrealMCPCommonUtils::GetGraphContentHash(const UEdGraph* Graph, bool bIncludeLayout)
 {
-    if (!Graph || !SourceNode || !TargetNode)
+    if (!Graph)
     {
-        return false;
+        return 0;
     }
-    
-    UEdGraphPin* SourcePin = FindPin(SourceNode, SourcePinName, EGPD_Output);
-    UEdGraphPin* TargetPin = FindPin(TargetNode, TargetPinName, EGPD_Input);
-    
-    if (SourcePin && TargetPin)
+
+    uint32 Hash = HashName(0, Graph->GetFName());
+    for (const UEdGraphNode* Node : Graph->Nodes)
     {
-        SourcePin->MakeLinkTo(TargetPin);
-        return true;
+        if (!Node)
+        {
+            continue;
+        }
+
+        Hash = HashCombine(Hash, GetTypeHash(Node->NodeGuid));
+        Hash = HashCombine(Hash, GetTypeHash(Node->GetClass()));
+        if (bIncludeLayout)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Node->NodePosX));
+            Hash = HashCombine(Hash, GetTypeHash(Node->NodePosY));
+            Hash = HashString(Hash, Node->NodeComment);
+        }
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            Hash = HashName(Hash, Pin->PinName);
+            Hash = HashPinType(Hash, Pin->PinType);
+            Hash = HashString(Hash, Pin->DefaultValue);
+            Hash = HashCombine(Hash, GetTypeHash(Pin->DefaultObject.Get()));
+            Hash = HashString(Hash, Pin->DefaultTextValue.ToString());
+            if (bIncludeLayout)
+            {
+                Hash = HashCombine(Hash, GetTypeHash(Pin->bHidden));
+            }
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                if (LinkedPin && LinkedPin->GetOwningNode())
+                {
+                    Hash = HashCombine(Hash, GetTypeHash(LinkedPin->GetOwningNode()->NodeGuid));
+                    Hash = HashName(Hash, LinkedPin->PinName);
+                }
+            }
+        }
     }
-    
-    return false;
+    return Hash;
 }
 
-UEdGraphPin* FUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
+uint32 FUnrealMCPCommonUtils::GetBlueprintContentHash(UBlueprint* Blueprint)
 {
-    if (!Node)
+    if (!Blueprint)
     {
-        return nullptr;
+        return 0;
     }
-    
-    // Log all pins for debugging
-    UE_LOG(LogTemp, Display, TEXT("FindPin: Looking for pin '%s' (Direction: %d) in node '%s'"), 
-           *PinName, (int32)Direction, *Node->GetName());
-    
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    uint32 Hash = GetTypeHash(Blueprint->ParentClass.Get());
+
+    // Graphs: node identity, pin types, defaults and links. Node positions don't affect the compiled class
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
     {
-        UE_LOG(LogTemp, Display, TEXT("  - Available pin: '%s', Direction: %d, Category: %s"), 
-               *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
+        Hash = HashCombine(Hash, GetGraphContentHash(Graph));
     }
-    
-    // First try exact match
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    // Member variables
+    for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
     {
-        if (Pin->PinName.ToString() == PinName && (Direction == EGPD_MAX || Pin->Direction == Direction))
-        {
-            UE_LOG(LogTemp, Display, TEXT("  - Found exact matching pin: '%s'"), *Pin->PinName.ToString());
-            return Pin;
-        }
+        Hash = HashName(Hash, Variable.VarName);
+        Hash = HashPinType(Hash, Variable.VarType);
+        Hash = HashString(Hash, Variable.DefaultValue);
+        Hash = HashCombine(Hash, GetTypeHash(Variable.PropertyFlags));
+        Hash = HashName(Hash, Variable.RepNotifyFunc);
     }
-    
-    // If no exact match and we're looking for a component reference, try case-insensitive match
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    // Components and class defaults are hashed from their serialized properties
+    FArchiveObjectCrc32 ObjectCrc;
+    if (Blueprint->SimpleConstructionScript)
     {
-        if (Pin->PinName.ToString().Equals(PinName, ESearchCase::IgnoreCase) && 
-            (Direction == EGPD_MAX || Pin->Direction == Direction))
+        for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
         {
-            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive matching pin: '%s'"), *Pin->PinName.ToString());
-            return Pin;
+            if (!Node)
+            {
+                continue;
+            }
+
+            Hash = HashName(Hash, Node->GetVariableName());
+            Hash = HashCombine(Hash, GetTypeHash(Node->ComponentClass.Get()));
+            Hash = HashName(Hash, Node->ParentComponentOrVariableName);
+            Hash = HashName(Hash, Node->AttachToName);
+            if (Node->ComponentTemplate)
+            {
+                Hash = ObjectCrc.Crc32(Node->ComponentTemplate, Hash);
+            }
         }
     }
-    
-    // If we're looking for a component output and didn't find it by name, try to find the first data output pin
-    if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(Node) != nullptr)
+
+    if (Blueprint->GeneratedClass)
     {
-        for (UEdGraphPin* Pin : Node->Pins)
+        if (UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject(false))
         {
-            if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
-            {
-                UE_LOG(LogTemp, Display, TEXT("  - Found fallback data output pin: '%s'"), *Pin->PinName.ToString());
-                return Pin;
-            }
+            Hash = ObjectCrc.Crc32(DefaultObject, Hash);
         }
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("  - No matching pin found for '%s'"), *PinName);
-    return nullptr;
+
+    return Hash;
 }
 
-// Actor utilities
-TSharedPtr<FJsonValue> FUnrealMCPCommonUtils::ActorToJson(AActor* Actor)
+bool FUnrealMCPCommonUtils::IsBlueprintUpToDate(UBlueprint* Blueprint)
 {
-    if (!Actor)
+    if (!Blueprint || Blueprint->Status == BS_Dirty || Blueprint->Status == BS_Unknown)
     {
-        return MakeShared<FJsonValueNull>();
+        return false;
     }
-    
-    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
-    ActorObject->SetStringField(TEXT("name"), Actor->GetName());
-    ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-    
-    FVector Location = Actor->GetActorLocation();
-    TArray<TSharedPtr<FJsonValue>> LocationArray;
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.X));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Y));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Z));
-    ActorObject->SetArrayField(TEXT("location"), LocationArray);
-    
-    FRotator Rotation = Actor->GetActorRotation();
-    TArray<TSharedPtr<FJsonValue>> RotationArray;
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Pitch));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Yaw));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Roll));
-    ActorObject->SetArrayField(TEXT("rotation"), RotationArray);
-    
-    FVector Scale = Actor->GetActorScale3D();
-    TArray<TSharedPtr<FJsonValue>> ScaleArray;
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.X));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
-    ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
-    
-    return MakeShared<FJsonValueObject>(ActorObject);
+
+    const FMCPBlueprintCompileState* CachedState = BlueprintCompileStates.Find(Blueprint);
+    return CachedState && CachedState->ContentHash == GetBlueprintContentHash(Blueprint);
 }
 
-TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::ActorToJsonObject(AActor* Actor, bool bDetailed)
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::CompileBlueprint(UBlueprint* Blueprint, bool bForce)
 {
-    if (!Actor)
+    if (!Blueprint)
     {
-        return nullptr;
+        return CreateErrorResponse(TEXT("Invalid blueprint"));
     }
-    
-    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
-    ActorObject->SetStringField(TEXT("name"), Actor->GetName());
-    ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-    
-    FVector Location = Actor->GetActorLocation();
-    TArray<TSharedPtr<FJsonValue>> LocationArray;
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.X));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Y));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Z));
-    ActorObject->SetArrayField(TEXT("location"), LocationArray);
-    
-    FRotator Rotation = Actor->GetActorRotation();
-    TArray<TSharedPtr<FJsonValue>> RotationArray;
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Pitch));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Yaw));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Roll));
-    ActorObject->SetArrayField(TEXT("rotation"), RotationArray);
-    
-    FVector Scale = Actor->GetActorScale3D();
-    TArray<TSharedPtr<FJsonValue>> ScaleArray;
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.X));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
-    ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
-    
-    return ActorObject;
-}
 
-UK2Node_Event* FUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
-{
-    if (!Graph)
+    // Errors are cached too: compiling unchanged content again would only report them again
+    if (!bForce && IsBlueprintUpToDate(Blueprint))
     {
-        return nullptr;
+        return CompileStateToJson(Blueprint, BlueprintCompileStates.FindChecked(Blueprint), true);
     }
 
-    // Look for existing event nodes
-    for (UEdGraphNode* Node : Graph->Nodes)
+    FCompilerResultsLog Results;
+    const double StartTime = FPlatformTime::Seconds();
+    FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &Results);
+
+    FMCPBlueprintCompileState& State = BlueprintCompileStates.FindOrAdd(Blueprint);
+    // Compiling may reconstruct nodes, so hash what was actually compiled
+    State.ContentHash = GetBlueprintContentHash(Blueprint);
+    State.Status = Blueprint->Status;
+    State.NumErrors = Results.NumErrors;
+    State.NumWarnings = Results.NumWarnings;
+    State.CompileTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    State.Messages.Reset();
+    for (const TSharedRef<FTokenizedMessage>& Message : Results.Messages)
     {
-        UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-        if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
-        {
-            UE_LOG(LogTemp, Display, TEXT("Found existing event node with name: %s"), *EventName);
-            return EventNode;
-        }
+        State.Messages.Add(MakeShared<FJsonValueObject>(CompilerMessageToJson(*Message)));
     }
 
-    return nullptr;
+    return CompileStateToJson(Blueprint, State, false);
 }
 
-bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
-                                     const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::ValidateBlueprintSkeleton(UBlueprint* Blueprint)
 {
-    if (!Object)
+    if (!Blueprint)
     {
-        OutErrorMessage = TEXT("Invalid object");
-        return false;
+        return CreateErrorResponse(TEXT("Invalid blueprint"));
     }
 
-    FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property)
-    {
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
-        return false;
-    }
+    const double StartTime = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonValue>> Messages;
+    int32 NumErrors = 0;
+    int32 NumWarnings = 0;
 
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
-    
-    // Handle different property types
-    if (Property->IsA<FBoolProperty>())
+    // Regenerate the skeleton class so variables, functions and dispatchers resolve against the current layout
+    FCompilerResultsLog SkeletonResults;
+    FKismetEditorUtilities::CompileBlueprint(Blueprint,
+        EBlueprintCompileOptions::RegenerateSkeletonOnly | EBlueprintCompileOptions::SkipGarbageCollection, &SkeletonResults);
+    for (const TSharedRef<FTokenizedMessage>& Message : SkeletonResults.Messages)
     {
-        ((FBoolProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsBool());
-        return true;
+        Messages.Add(MakeShared<FJsonValueObject>(CompilerMessageToJson(*Message)));
     }
-    else if (Property->IsA<FIntProperty>())
+    NumErrors += SkeletonResults.NumErrors;
+    NumWarnings += SkeletonResults.NumWarnings;
+
+    // Validate every node against the new skeleton, keeping track of which node each message belongs to
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
     {
-        int32 IntValue = static_cast<int32>(Value->AsNumber());
-        FIntProperty* IntProperty = CastField<FIntProperty>(Property);
-        if (IntProperty)
+        if (!Graph)
         {
-            IntProperty->SetPropertyValue_InContainer(Object, IntValue);
-            return true;
+            continue;
         }
-    }
-    else if (Property->IsA<FFloatProperty>())
-    {
-        ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
-        return true;
-    }
-    else if (Property->IsA<FStrProperty>())
-    {
-        ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
-        return true;
-    }
-    else if (Property->IsA<FByteProperty>())
-    {
-        FByteProperty* ByteProp = CastField<FByteProperty>(Property);
-        UEnum* EnumDef = ByteProp ? ByteProp->GetIntPropertyEnum() : nullptr;
-        
-        // If this is a TEnumAsByte property (has associated enum)
-        if (EnumDef)
+
+        const UEdGraphSchema* Schema = Graph->GetSchema();
+        for (UEdGraphNode* Node : Graph->Nodes)
         {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
+            if (!Node)
             {
-                uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-                ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
-                      *PropertyName, ByteValue);
-                return true;
+                continue;
             }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
+
+            FCompilerResultsLog NodeResults;
+            Node->ValidateNodeDuringCompilation(NodeResults);
+            for (const TSharedRef<FTokenizedMessage>& Message : NodeResults.Messages)
             {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    uint8 ByteValue = FCString::Atoi(*EnumValueName);
-                    ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
-                          *PropertyName, *EnumValueName, ByteValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
+                TSharedPtr<FJsonObject> MessageObj = CompilerMessageToJson(*Message);
+                MessageObj->SetStringField(TEXT("graph"), Graph->GetName());
+                MessageObj->SetStringField(TEXT("node_id"), Node->NodeGuid.ToString());
+                MessageObj->SetStringField(TEXT("node_title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+                Messages.Add(MakeShared<FJsonValueObject>(MessageObj));
+            }
+            NumErrors += NodeResults.NumErrors;
+            NumWarnings += NodeResults.NumWarnings;
+
+            for (UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin->bOrphanedPin)
                 {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
+                    Messages.Add(MakeShared<FJsonValueObject>(NodeMessageToJson(TEXT("error"),
+                        FString::Printf(TEXT("Pin '%s' no longer exists on the node"), *Pin->PinName.ToString()), Graph, Node)));
+                    ++NumErrors;
                 }
-                
-                if (EnumValue != INDEX_NONE)
+
+                // Report each broken link once, from its output side
+                if (!Schema || Pin->Direction != EGPD_Output)
                 {
-                    ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
+                    continue;
                 }
-                else
+                for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
                 {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
+                    if (LinkedPin && Schema->CanCreateConnection(Pin, LinkedPin).Response == CONNECT_RESPONSE_DISALLOW)
                     {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
+                        Messages.Add(MakeShared<FJsonValueObject>(NodeMessageToJson(TEXT("error"),
+                            FString::Printf(TEXT("Pin '%s' can no longer connect to '%s' on '%s'"),
+                                *Pin->PinName.ToString(), *LinkedPin->PinName.ToString(),
+                                *LinkedPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString()), Graph, Node)));
+                        ++NumErrors;
                     }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
                 }
             }
         }
-        else
+    }
+
+    // No bytecode was generated, so leave the blueprint for a full compile
+    Blueprint->Status = BS_Dirty;
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("name"), Blueprint->GetName());
+    ResultObj->SetStringField(TEXT("mode"), TEXT("skeleton"));
+    ResultObj->SetBoolField(TEXT("valid"), NumErrors == 0);
+    ResultObj->SetNumberField(TEXT("error_count"), NumErrors);
+    ResultObj->SetNumberField(TEXT("warning_count"), NumWarnings);
+    ResultObj->SetNumberField(TEXT("compile_time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    ResultObj->SetArrayField(TEXT("messages"), Messages);
+    return ResultObj;
+}
+
+namespace
+{
+    /** Collects lint issues in the same shape as the node messages of a skeleton validation, plus an issue code */
+    struct FMCPLintResults
+    {
+        TArray<TSharedPtr<FJsonValue>> Issues;
+        int32 NumErrors = 0;
+        int32 NumWarnings = 0;
+
+        void Add(bool bError, const TCHAR* Code, const FString& Message, const UEdGraph* Graph, const UEdGraphNode* Node, const UEdGraphPin* Pin = nullptr)
+        {
+            TSharedPtr<FJsonObject> IssueObj = NodeMessageToJson(bError ? TEXT("error") : TEXT("warning"), Message, Graph, Node);
+            IssueObj->SetStringField(TEXT("code"), Code);
+            if (Pin)
+            {
+                IssueObj->SetStringField(TEXT("pin"), Pin->PinName.ToString());
+            }
+            Issues.Add(MakeShared<FJsonValueObject>(IssueObj));
+            ++(bError ? NumErrors : NumWarnings);
+        }
+    };
+
+    /** Whether a member of the blueprint itself exists, even if the skeleton class hasn't been regenerated since it was added */
+    bool IsPendingBlueprintMember(UBlueprint* Blueprint, const FName& MemberName)
+    {
+        if (FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, MemberName) != INDEX_NONE)
+        {
+            return true;
+        }
+        if (Blueprint->SimpleConstructionScript && FUnrealMCPCommonUtils::FindSCSNode(Blueprint->SimpleConstructionScript, MemberName))
         {
-            // Regular byte property
-            uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-            ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
             return true;
         }
+        return Blueprint->FunctionGraphs.ContainsByPredicate([&MemberName](const UEdGraph* Graph) { return Graph && Graph->GetFName() == MemberName; });
     }
-    else if (Property->IsA<FEnumProperty>())
+
+    void LintNode(UBlueprint* Blueprint, UClass* BlueprintClass, const UEdGraph* Graph, UEdGraphNode* Node, FMCPLintResults& Results)
     {
-        FEnumProperty* EnumProp = CastField<FEnumProperty>(Property);
-        UEnum* EnumDef = EnumProp ? EnumProp->GetEnum() : nullptr;
-        FNumericProperty* UnderlyingNumericProp = EnumProp ? EnumProp->GetUnderlyingProperty() : nullptr;
-        
-        if (EnumDef && UnderlyingNumericProp)
+        // Pins: orphans, links the schema no longer allows, unresolved wildcards
+        const UEdGraphSchema* Schema = Graph->GetSchema();
+        bool bHasExecInput = false;
+        bool bHasLinkedExecInput = false;
+        bool bHasExecOutput = false;
+        bool bHasDataOutput = false;
+        bool bHasLinkedDataOutput = false;
+        bool bHasWildcard = false;
+        bool bHasLinkedWildcard = false;
+        for (UEdGraphPin* Pin : Node->Pins)
         {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
+            const bool bExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+            const bool bLinked = Pin->LinkedTo.Num() > 0;
+            if (Pin->bOrphanedPin)
             {
-                int64 EnumValue = static_cast<int64>(Value->AsNumber());
-                UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
-                      *PropertyName, EnumValue);
-                return true;
+                Results.Add(true, TEXT("orphaned_pin"), FString::Printf(TEXT("Pin '%s' no longer exists on the node"), *Pin->PinName.ToString()), Graph, Node, Pin);
             }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
+
+            if (Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
             {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    int64 EnumValue = FCString::Atoi64(*EnumValueName);
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
+                bHasWildcard = true;
+                bHasLinkedWildcard |= bLinked;
+            }
+
+            if (Pin->Direction == EGPD_Input)
+            {
+                bHasExecInput |= bExec && !Pin->bHidden;
+                bHasLinkedExecInput |= bExec && bLinked;
+                continue;
+            }
+
+            bHasExecOutput |= bExec;
+            bHasDataOutput |= !bExec && !Pin->bHidden;
+            bHasLinkedDataOutput |= !bExec && bLinked;
+            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                if (Schema && LinkedPin && Schema->CanCreateConnection(Pin, LinkedPin).Response == CONNECT_RESPONSE_DISALLOW)
                 {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
+                    Results.Add(true, TEXT("type_mismatch"), FString::Printf(TEXT("Pin '%s' (%s) is linked to incompatible pin '%s' (%s) on '%s'"),
+                        *Pin->PinName.ToString(), *UEdGraphSchema_K2::TypeToText(Pin->PinType).ToString(),
+                        *LinkedPin->PinName.ToString(), *UEdGraphSchema_K2::TypeToText(LinkedPin->PinType).ToString(),
+                        *LinkedPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString()), Graph, Node, Pin);
                 }
-                
-                if (EnumValue != INDEX_NONE)
+            }
+        }
+
+        if (bHasWildcard && !bHasLinkedWildcard)
+        {
+            Results.Add(true, TEXT("unresolved_wildcard"), TEXT("Wildcard pins are not connected, so the node's type can't be determined"), Graph, Node);
+        }
+
+        // Reachability: terminators and macro tunnels are wired by the graph itself
+        if (!Node->IsA<UK2Node_FunctionTerminator>() && !Node->IsA<UK2Node_Tunnel>())
+        {
+            if (bHasExecInput && !bHasLinkedExecInput)
+            {
+                Results.Add(false, TEXT("unconnected_exec"), TEXT("Exec input is not connected, so the node never runs"), Graph, Node);
+            }
+            else if (!bHasExecInput && !bHasExecOutput && bHasDataOutput && !bHasLinkedDataOutput)
+            {
+                Results.Add(false, TEXT("unused_pure_node"), TEXT("Node has no exec pins and none of its outputs are used"), Graph, Node);
+            }
+        }
+
+        // References to members that no longer exist
+        if (UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+        {
+            const bool bSelfMember = VariableNode->VariableReference.IsSelfContext();
+            if (!VariableNode->GetPropertyForVariable() && !(bSelfMember && IsPendingBlueprintMember(Blueprint, VariableNode->GetVarName())))
+            {
+                Results.Add(true, TEXT("unresolved_variable"), FString::Printf(TEXT("Variable '%s' can't be found"), *VariableNode->GetVarNameString()), Graph, Node);
+            }
+        }
+        else if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+        {
+            if (EventNode->bOverrideFunction && !EventNode->FindEventSignatureFunction())
+            {
+                Results.Add(true, TEXT("missing_event_function"), FString::Printf(TEXT("Event '%s' overrides a function that no longer exists"),
+                    *EventNode->EventReference.GetMemberName().ToString()), Graph, Node);
+            }
+        }
+        else if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            const UFunction* Function = FunctionNode->GetTargetFunction();
+            const FName FunctionName = FunctionNode->FunctionReference.GetMemberName();
+            if (!Function)
+            {
+                if (!(FunctionNode->FunctionReference.IsSelfContext() && IsPendingBlueprintMember(Blueprint, FunctionName)))
                 {
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
+                    Results.Add(true, TEXT("missing_function"), FString::Printf(TEXT("Function '%s' can't be found"), *FunctionName.ToString()), Graph, Node);
                 }
-                else
+                return;
+            }
+
+            // A call on another class needs a target unless the blueprint is of that class
+            const UEdGraphPin* SelfPin = Node->FindPin(UEdGraphSchema_K2::PN_Self, EGPD_Input);
+            const UClass* OwnerClass = Function->GetOwnerClass();
+            if (SelfPin && !SelfPin->bHidden && SelfPin->LinkedTo.Num() == 0 && !Function->HasAnyFunctionFlags(FUNC_Static) &&
+                OwnerClass && !OwnerClass->HasAnyClassFlags(CLASS_Interface) && BlueprintClass && !BlueprintClass->IsChildOf(OwnerClass))
+            {
+                Results.Add(true, TEXT("missing_target"), FString::Printf(TEXT("'%s' needs a %s target"), *FunctionName.ToString(), *OwnerClass->GetName()), Graph, Node, SelfPin);
+            }
+
+            // Non-const by-ref parameters need a variable to operate on, unless the function creates one
+            TArray<FString> AutoCreateRefTerms;
+            Function->GetMetaData(FBlueprintMetadata::MD_AutoCreateRefTerm).ParseIntoArray(AutoCreateRefTerms, TEXT(","), true);
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin->Direction == EGPD_Input && !Pin->bHidden && Pin->LinkedTo.Num() == 0 && Pin->PinType.bIsReference &&
+                    !Pin->PinType.bIsConst && !AutoCreateRefTerms.ContainsByPredicate([Pin](const FString& Term) { return Term.TrimStartAndEnd() == Pin->PinName.ToString(); }))
                 {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
+                    Results.Add(true, TEXT("required_pin"), FString::Printf(TEXT("By-ref input '%s' must be connected"), *Pin->PinName.ToString()), Graph, Node, Pin);
                 }
             }
         }
     }
-    
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::LintBlueprint(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return CreateErrorResponse(TEXT("Invalid blueprint"));
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    UClass* BlueprintClass = Blueprint->SkeletonGeneratedClass ? Blueprint->SkeletonGeneratedClass.Get() : Blueprint->ParentClass.Get();
+
+    FMCPLintResults Results;
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node && Node->IsA<UK2Node>())
+            {
+                LintNode(Blueprint, BlueprintClass, Graph, Node, Results);
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("name"), Blueprint->GetName());
+    ResultObj->SetStringField(TEXT("mode"), TEXT("lint"));
+    ResultObj->SetBoolField(TEXT("valid"), Results.NumErrors == 0);
+    ResultObj->SetNumberField(TEXT("error_count"), Results.NumErrors);
+    ResultObj->SetNumberField(TEXT("warning_count"), Results.NumWarnings);
+    ResultObj->SetNumberField(TEXT("lint_time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    ResultObj->SetArrayField(TEXT("issues"), Results.Issues);
+    return ResultObj;
+}
+
+TArray<TSharedPtr<FJsonValue>> FUnrealMCPCommonUtils::CompileBlueprints(const TArray<UBlueprint*>& Blueprints)
+{
+    TArray<TSharedPtr<FJsonValue>> Results;
+
+    const double StartTime = FPlatformTime::Seconds();
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        if (Blueprint)
+        {
+            FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+        }
+    }
+    FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+    const double BatchTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        if (!Blueprint)
+        {
+            continue;
+        }
+
+        // The queue compiles without a client results log, so only clean compiles are recorded for
+        // skipping. Anything with warnings or errors is compiled again on request to report its messages
+        if (Blueprint->Status == BS_UpToDate)
+        {
+            FMCPBlueprintCompileState& State = BlueprintCompileStates.FindOrAdd(Blueprint);
+            State.ContentHash = GetBlueprintContentHash(Blueprint);
+            State.Status = Blueprint->Status;
+            State.NumErrors = 0;
+            State.NumWarnings = 0;
+            State.CompileTimeMs = BatchTimeMs;
+            State.Messages.Reset();
+        }
+        else
+        {
+            BlueprintCompileStates.Remove(Blueprint);
+        }
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), Blueprint->GetName());
+        ResultObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+        ResultObj->SetBoolField(TEXT("compiled"), Blueprint->Status != BS_Error);
+        ResultObj->SetBoolField(TEXT("skipped"), false);
+        ResultObj->SetStringField(TEXT("status"), BlueprintStatusToString(Blueprint->Status));
+        ResultObj->SetNumberField(TEXT("batch_time_ms"), BatchTimeMs);
+        Results.Add(MakeShared<FJsonValueObject>(ResultObj));
+    }
+
+    return Results;
+}
+
+// Blueprint variable utilities
+namespace
+{
+    /** Find a class, struct or enum by object path or by name, with or without its C++ prefix */
+    template<typename T>
+    T* FindTypeObject(const FString& TypeName)
+    {
+        if (TypeName.Contains(TEXT("/")))
+        {
+            return LoadObject<T>(nullptr, *TypeName);
+        }
+
+        T* Found = FindFirstObject<T>(*TypeName, EFindFirstObjectOptions::NativeFirst);
+        if (!Found && TypeName.Len() > 1 && FChar::IsUpper(TypeName[1]) &&
+            (TypeName[0] == TEXT('U') || TypeName[0] == TEXT('A') || TypeName[0] == TEXT('F')))
+        {
+            Found = FindFirstObject<T>(*TypeName.Mid(1), EFindFirstObjectOptions::NativeFirst);
+        }
+        return Found;
+    }
+
+    /** Parse the type of a single value, i.e. a pin type without container */
+    bool ParseTerminalPinType(const FString& Category, const FString& SubType, FEdGraphPinType& OutPinType, FString& OutErrorMessage)
+    {
+        if (Category == TEXT("Boolean") || Category == TEXT("Bool"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
+        }
+        else if (Category == TEXT("Byte"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
+        }
+        else if (Category == TEXT("Integer") || Category == TEXT("Int"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Int;
+        }
+        else if (Category == TEXT("Integer64") || Category == TEXT("Int64"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Int64;
+        }
+        else if (Category == TEXT("Float") || Category == TEXT("Double"))
+        {
+            // Blueprint floats are real numbers; the subcategory picks the precision
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Real;
+            OutPinType.PinSubCategory = Category == TEXT("Double") ? UEdGraphSchema_K2::PC_Double : UEdGraphSchema_K2::PC_Float;
+        }
+        else if (Category == TEXT("String"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_String;
+        }
+        else if (Category == TEXT("Name"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Name;
+        }
+        else if (Category == TEXT("Text"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Text;
+        }
+        else if (Category == TEXT("Vector"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+            OutPinType.PinSubCategoryObject = TBaseStructure<FVector>::Get();
+        }
+        else if (Category == TEXT("Rotator"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+            OutPinType.PinSubCategoryObject = TBaseStructure<FRotator>::Get();
+        }
+        else if (Category == TEXT("Transform"))
+        {
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+            OutPinType.PinSubCategoryObject = TBaseStructure<FTransform>::Get();
+        }
+        else if (Category == TEXT("Object") || Category == TEXT("Class") || Category == TEXT("SoftObject") ||
+                 Category == TEXT("SoftClass") || Category == TEXT("Interface"))
+        {
+            UClass* Class = FindTypeObject<UClass>(SubType);
+            if (!Class)
+            {
+                OutErrorMessage = FString::Printf(TEXT("%s type needs a known class in 'sub_type', got '%s'"), *Category, *SubType);
+                return false;
+            }
+            if (Category == TEXT("Interface") && !Class->HasAnyClassFlags(CLASS_Interface))
+            {
+                OutErrorMessage = FString::Printf(TEXT("'%s' is not an interface"), *SubType);
+                return false;
+            }
+
+            OutPinType.PinCategory =
+                Category == TEXT("Object") ? UEdGraphSchema_K2::PC_Object :
+                Category == TEXT("Class") ? UEdGraphSchema_K2::PC_Class :
+                Category == TEXT("SoftObject") ? UEdGraphSchema_K2::PC_SoftObject :
+                Category == TEXT("SoftClass") ? UEdGraphSchema_K2::PC_SoftClass :
+                UEdGraphSchema_K2::PC_Interface;
+            OutPinType.PinSubCategoryObject = Class;
+        }
+        else if (Category == TEXT("Struct"))
+        {
+            UScriptStruct* Struct = FindTypeObject<UScriptStruct>(SubType);
+            if (!Struct)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Struct type needs a known struct in 'sub_type', got '%s'"), *SubType);
+                return false;
+            }
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+            OutPinType.PinSubCategoryObject = Struct;
+        }
+        else if (Category == TEXT("Enum"))
+        {
+            // Blueprint enum variables are bytes typed by their enum
+            UEnum* Enum = FindTypeObject<UEnum>(SubType);
+            if (!Enum)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Enum type needs a known enum in 'sub_type', got '%s'"), *SubType);
+                return false;
+            }
+            OutPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
+            OutPinType.PinSubCategoryObject = Enum;
+        }
+        else
+        {
+            OutErrorMessage = FString::Printf(TEXT("Unsupported variable type: %s"), *Category);
+            return false;
+        }
+
+        return true;
+    }
+}
+
+bool FUnrealMCPCommonUtils::ParsePinType(const TSharedPtr<FJsonValue>& TypeValue, FEdGraphPinType& OutPinType, FString& OutErrorMessage)
+{
+    OutPinType = FEdGraphPinType();
+    if (!TypeValue.IsValid())
+    {
+        OutErrorMessage = TEXT("Missing variable type");
+        return false;
+    }
+
+    // A plain type name describes a single value
+    FString TypeName;
+    if (TypeValue->TryGetString(TypeName))
+    {
+        return ParseTerminalPinType(TypeName, FString(), OutPinType, OutErrorMessage);
+    }
+
+    const TSharedPtr<FJsonObject>* TypeObject = nullptr;
+    if (!TypeValue->TryGetObject(TypeObject) || !(*TypeObject)->TryGetStringField(TEXT("category"), TypeName))
+    {
+        OutErrorMessage = TEXT("Variable type must be a type name or an object with a 'category'");
+        return false;
+    }
+
+    FString SubType;
+    (*TypeObject)->TryGetStringField(TEXT("sub_type"), SubType);
+    if (!ParseTerminalPinType(TypeName, SubType, OutPinType, OutErrorMessage))
+    {
+        return false;
+    }
+
+    FString Container;
+    if (!(*TypeObject)->TryGetStringField(TEXT("container"), Container) || Container.IsEmpty() || Container == TEXT("None"))
+    {
+        return true;
+    }
+
+    if (Container == TEXT("Array"))
+    {
+        OutPinType.ContainerType = EPinContainerType::Array;
+    }
+    else if (Container == TEXT("Set"))
+    {
+        OutPinType.ContainerType = EPinContainerType::Set;
+    }
+    else if (Container == TEXT("Map"))
+    {
+        // The type above is the key type; the value type is described separately
+        FEdGraphPinType ValuePinType;
+        if (!ParsePinType((*TypeObject)->TryGetField(TEXT("value_type")), ValuePinType, OutErrorMessage))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Invalid map 'value_type': %s"), *OutErrorMessage);
+            return false;
+        }
+        if (ValuePinType.IsContainer())
+        {
+            OutErrorMessage = TEXT("Map values cannot be containers");
+            return false;
+        }
+        OutPinType.ContainerType = EPinContainerType::Map;
+        OutPinType.PinValueType = FEdGraphTerminalType::FromPinType(ValuePinType);
+    }
+    else
+    {
+        OutErrorMessage = FString::Printf(TEXT("Unsupported container type: %s"), *Container);
+        return false;
+    }
+
+    return true;
+}
+
+FBPVariableDescription FUnrealMCPCommonUtils::MakeVariableDescription(const FName& VariableName, const FEdGraphPinType& PinType, const FString& DefaultValue)
+{
+    // Mirrors FBlueprintEditorUtils::AddMemberVariable, minus the structural modification it triggers
+    FBPVariableDescription Variable;
+    Variable.VarName = VariableName;
+    Variable.VarGuid = FGuid::NewGuid();
+    Variable.FriendlyName = FName::NameToDisplayString(VariableName.ToString(), PinType.PinCategory == UEdGraphSchema_K2::PC_Boolean);
+    Variable.VarType = PinType;
+    Variable.PropertyFlags |= (CPF_Edit | CPF_BlueprintVisible | CPF_DisableEditOnInstance);
+    if (PinType.PinCategory == UEdGraphSchema_K2::PC_MCDelegate)
+    {
+        Variable.PropertyFlags |= CPF_BlueprintAssignable | CPF_BlueprintCallable;
+    }
+    Variable.ReplicationCondition = COND_None;
+    Variable.Category = UEdGraphSchema_K2::VR_DefaultCategory;
+    Variable.DefaultValue = DefaultValue;
+    return Variable;
+}
+
+// Graph export utilities
+namespace
+{
+    /** Exported nodes of a graph, kept until something reports a change to the graph */
+    struct FMCPGraphExport
+    {
+        bool bDirty = true;
+        FDelegateHandle GraphChangedHandle;
+        TArray<TSharedPtr<FJsonValue>> Nodes;
+    };
+
+    TMap<TWeakObjectPtr<UEdGraph>, TSharedPtr<FMCPGraphExport>> GraphExports;
+    FDelegateHandle GraphExportObjectModifiedHandle;
+    FDelegateHandle GraphExportPropertyChangedHandle;
+
+    /**
+     * Node moves, links and pin defaults don't notify the graph, but edits call Modify on the node (pins forward to their
+     * node) and MarkBlueprintAsModified ends in a property change on the blueprint, so listening for both covers them
+     */
+    void InvalidateGraphExports(UObject* Object)
+    {
+        if (GraphExports.Num() == 0 || !Object)
+        {
+            return;
+        }
+
+        if (const UEdGraphNode* Node = Cast<UEdGraphNode>(Object))
+        {
+            Object = Node->GetGraph();
+        }
+
+        if (UEdGraph* Graph = Cast<UEdGraph>(Object))
+        {
+            if (TSharedPtr<FMCPGraphExport>* Export = GraphExports.Find(Graph))
+            {
+                (*Export)->bDirty = true;
+            }
+        }
+        else if (const UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+        {
+            for (const TPair<TWeakObjectPtr<UEdGraph>, TSharedPtr<FMCPGraphExport>>& Entry : GraphExports)
+            {
+                const UEdGraph* ExportedGraph = Entry.Key.Get();
+                if (ExportedGraph && ExportedGraph->IsIn(Blueprint))
+                {
+                    Entry.Value->bDirty = true;
+                }
+            }
+        }
+    }
+
+    /** Native types are named briefly, asset types by path so they can be loaded back */
+    FString TypeObjectToString(const UObject* TypeObject)
+    {
+        return TypeObject->GetOutermost()->HasAnyPackageFlags(PKG_CompiledIn) ? TypeObject->GetName() : TypeObject->GetPathName();
+    }
+
+    void TerminalTypeToJson(const FName& Category, const FName& SubCategory, const UObject* SubCategoryObject, const TSharedPtr<FJsonObject>& TypeObj)
+    {
+        // Names match the categories ParsePinType accepts
+        static const TMap<FName, FString> CategoryNames = {
+            { UEdGraphSchema_K2::PC_Boolean, TEXT("Boolean") },
+            { UEdGraphSchema_K2::PC_Byte, TEXT("Byte") },
+            { UEdGraphSchema_K2::PC_Int, TEXT("Integer") },
+            { UEdGraphSchema_K2::PC_Int64, TEXT("Integer64") },
+            { UEdGraphSchema_K2::PC_String, TEXT("String") },
+            { UEdGraphSchema_K2::PC_Name, TEXT("Name") },
+            { UEdGraphSchema_K2::PC_Text, TEXT("Text") },
+            { UEdGraphSchema_K2::PC_Struct, TEXT("Struct") },
+            { UEdGraphSchema_K2::PC_Object, TEXT("Object") },
+            { UEdGraphSchema_K2::PC_Class, TEXT("Class") },
+            { UEdGraphSchema_K2::PC_SoftObject, TEXT("SoftObject") },
+            { UEdGraphSchema_K2::PC_SoftClass, TEXT("SoftClass") },
+            { UEdGraphSchema_K2::PC_Interface, TEXT("Interface") }
+        };
+
+        FString CategoryName;
+        if ((Category == UEdGraphSchema_K2::PC_Byte || Category == UEdGraphSchema_K2::PC_Enum) && SubCategoryObject)
+        {
+            CategoryName = TEXT("Enum");
+        }
+        else if (Category == UEdGraphSchema_K2::PC_Real)
+        {
+            CategoryName = SubCategory == UEdGraphSchema_K2::PC_Double ? TEXT("Double") : TEXT("Float");
+        }
+        else if (const FString* KnownName = CategoryNames.Find(Category))
+        {
+            CategoryName = *KnownName;
+        }
+        else
+        {
+            CategoryName = Category.ToString();
+        }
+
+        TypeObj->SetStringField(TEXT("category"), CategoryName);
+        if (SubCategoryObject)
+        {
+            TypeObj->SetStringField(TEXT("sub_type"), TypeObjectToString(SubCategoryObject));
+        }
+    }
+
+    TSharedPtr<FJsonObject> GraphNodeToJson(const UEdGraphNode* Node)
+    {
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("id"), Node->NodeGuid.ToString());
+        NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+        NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+
+        TArray<TSharedPtr<FJsonValue>> Position;
+        Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosX));
+        Position.Add(MakeShared<FJsonValueNumber>(Node->NodePosY));
+        NodeObj->SetArrayField(TEXT("position"), Position);
+        if (!Node->NodeComment.IsEmpty())
+        {
+            NodeObj->SetStringField(TEXT("comment"), Node->NodeComment);
+        }
+
+        // Hidden pins are left out unless something is connected to them
+        TArray<TSharedPtr<FJsonValue>> Pins;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin->bHidden && Pin->LinkedTo.Num() == 0)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> PinObj = MakeShared<FJsonObject>();
+            PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
+            PinObj->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("input") : TEXT("output"));
+            PinObj->SetObjectField(TEXT("type"), FUnrealMCPCommonUtils::PinTypeToJson(Pin->PinType));
+
+            if (Pin->DefaultObject)
+            {
+                PinObj->SetStringField(TEXT("default"), Pin->DefaultObject->GetPathName());
+            }
+            else if (!Pin->DefaultTextValue.IsEmpty())
+            {
+                PinObj->SetStringField(TEXT("default"), Pin->DefaultTextValue.ToString());
+            }
+            else if (!Pin->DefaultValue.IsEmpty())
+            {
+                PinObj->SetStringField(TEXT("default"), Pin->DefaultValue);
+            }
+
+            if (Pin->LinkedTo.Num() > 0)
+            {
+                TArray<TSharedPtr<FJsonValue>> Links;
+                for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                {
+                    if (LinkedPin && LinkedPin->GetOwningNode())
+                    {
+                        TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
+                        LinkObj->SetStringField(TEXT("node"), LinkedPin->GetOwningNode()->NodeGuid.ToString());
+                        LinkObj->SetStringField(TEXT("pin"), LinkedPin->PinName.ToString());
+                        Links.Add(MakeShared<FJsonValueObject>(LinkObj));
+                    }
+                }
+                PinObj->SetArrayField(TEXT("links"), Links);
+            }
+
+            Pins.Add(MakeShared<FJsonValueObject>(PinObj));
+        }
+        NodeObj->SetArrayField(TEXT("pins"), Pins);
+        return NodeObj;
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::PinTypeToJson(const FEdGraphPinType& PinType)
+{
+    TSharedPtr<FJsonObject> TypeObj = MakeShared<FJsonObject>();
+    TerminalTypeToJson(PinType.PinCategory, PinType.PinSubCategory, PinType.PinSubCategoryObject.Get(), TypeObj);
+
+    if (PinType.IsArray())
+    {
+        TypeObj->SetStringField(TEXT("container"), TEXT("Array"));
+    }
+    else if (PinType.IsSet())
+    {
+        TypeObj->SetStringField(TEXT("container"), TEXT("Set"));
+    }
+    else if (PinType.IsMap())
+    {
+        TSharedPtr<FJsonObject> ValueTypeObj = MakeShared<FJsonObject>();
+        TerminalTypeToJson(PinType.PinValueType.TerminalCategory, PinType.PinValueType.TerminalSubCategory,
+                           PinType.PinValueType.TerminalSubCategoryObject.Get(), ValueTypeObj);
+        TypeObj->SetStringField(TEXT("container"), TEXT("Map"));
+        TypeObj->SetObjectField(TEXT("value_type"), ValueTypeObj);
+    }
+
+    if (PinType.bIsReference)
+    {
+        TypeObj->SetBoolField(TEXT("by_ref"), true);
+    }
+    return TypeObj;
+}
+
+TArray<TSharedPtr<FJsonValue>> FUnrealMCPCommonUtils::GetGraphNodesJson(UEdGraph* Graph)
+{
+    if (!Graph)
+    {
+        return TArray<TSharedPtr<FJsonValue>>();
+    }
+
+    TSharedPtr<FMCPGraphExport>& Export = GraphExports.FindOrAdd(Graph);
+    if (Export.IsValid() && !Export->bDirty)
+    {
+        return Export->Nodes;
+    }
+
+    if (!Export.IsValid())
+    {
+        if (!GraphExportObjectModifiedHandle.IsValid())
+        {
+            GraphExportObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&InvalidateGraphExports);
+            GraphExportPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject* Object, FPropertyChangedEvent&)
+            {
+                InvalidateGraphExports(Object);
+            });
+        }
+
+        // Adding, removing and reconstructing nodes notify the graph itself
+        Export = MakeShared<FMCPGraphExport>();
+        TWeakPtr<FMCPGraphExport> WeakExport = Export;
+        Export->GraphChangedHandle = Graph->AddOnGraphChangedHandler(FOnGraphChanged::FDelegate::CreateLambda(
+            [WeakExport](const FEdGraphEditAction&)
+            {
+                if (TSharedPtr<FMCPGraphExport> PinnedExport = WeakExport.Pin())
+                {
+                    PinnedExport->bDirty = true;
+                }
+            }));
+    }
+
+    // Drop exports of graphs that have since been deleted
+    for (auto It = GraphExports.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    TSharedPtr<FMCPGraphExport> CurrentExport = GraphExports.FindChecked(Graph);
+    CurrentExport->bDirty = false;
+    CurrentExport->Nodes.Reset(Graph->Nodes.Num());
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node)
+        {
+            CurrentExport->Nodes.Add(MakeShared<FJsonValueObject>(GraphNodeToJson(Node)));
+        }
+    }
+    return CurrentExport->Nodes;
+}
+
+void FUnrealMCPCommonUtils::ClearGraphExports()
+{
+    for (const TPair<TWeakObjectPtr<UEdGraph>, TSharedPtr<FMCPGraphExport>>& Entry : GraphExports)
+    {
+        if (UEdGraph* Graph = Entry.Key.Get())
+        {
+            Graph->RemoveOnGraphChangedHandler(Entry.Value->GraphChangedHandle);
+        }
+    }
+    GraphExports.Reset();
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(GraphExportObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(GraphExportPropertyChangedHandle);
+    GraphExportObjectModifiedHandle.Reset();
+    GraphExportPropertyChangedHandle.Reset();
+}
+
+// Graph node index utilities
+namespace
+{
+    /** Nodes of every graph of one blueprint, keyed by node class (and its node superclasses) and by referenced member */
+    struct FMCPNodeIndex
+    {
+        bool bDirty = true;
+        FDelegateHandle BlueprintChangedHandle;
+        TArray<TWeakObjectPtr<UEdGraph>> Graphs;
+        TArray<FDelegateHandle> GraphChangedHandles;
+        TArray<TWeakObjectPtr<UEdGraphNode>> Nodes;
+        TMultiMap<FName, int32> NodesByClass;
+        TMultiMap<FName, int32> NodesByMember;
+    };
+
+    TMap<TWeakObjectPtr<UBlueprint>, TSharedPtr<FMCPNodeIndex>> NodeIndices;
+
+    void RebuildNodeIndex(const TSharedPtr<FMCPNodeIndex>& Index, const TArray<UEdGraph*>& Graphs)
+    {
+        for (int32 GraphIndex = 0; GraphIndex < Index->Graphs.Num(); ++GraphIndex)
+        {
+            if (UEdGraph* OldGraph = Index->Graphs[GraphIndex].Get())
+            {
+                OldGraph->RemoveOnGraphChangedHandler(Index->GraphChangedHandles[GraphIndex]);
+            }
+        }
+
+        Index->Graphs.Reset();
+        Index->GraphChangedHandles.Reset();
+        Index->Nodes.Reset();
+        Index->NodesByClass.Reset();
+        Index->NodesByMember.Reset();
+
+        // Adding or removing nodes notifies the graph, which is all it takes to invalidate the index
+        TWeakPtr<FMCPNodeIndex> WeakIndex = Index;
+        for (UEdGraph* Graph : Graphs)
+        {
+            Index->Graphs.Add(Graph);
+            Index->GraphChangedHandles.Add(Graph->AddOnGraphChangedHandler(FOnGraphChanged::FDelegate::CreateLambda(
+                [WeakIndex](const FEdGraphEditAction&)
+                {
+                    if (TSharedPtr<FMCPNodeIndex> PinnedIndex = WeakIndex.Pin())
+                    {
+                        PinnedIndex->bDirty = true;
+                    }
+                })));
+
+            for (UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (!Node)
+                {
+                    continue;
+                }
+
+                const int32 NodeIndex = Index->Nodes.Add(Node);
+                for (UClass* Class = Node->GetClass(); Class && Class->IsChildOf(UEdGraphNode::StaticClass()); Class = Class->GetSuperClass())
+                {
+                    Index->NodesByClass.Add(Class->GetFName(), NodeIndex);
+                }
+
+                const FName MemberName = FUnrealMCPCommonUtils::GetNodeMemberName(Node);
+                if (MemberName != NAME_None)
+                {
+                    Index->NodesByMember.Add(MemberName, NodeIndex);
+                }
+            }
+        }
+
+        Index->bDirty = false;
+    }
+
+    bool IsNodeOfClass(const UEdGraphNode* Node, const FName& NodeClassName)
+    {
+        for (const UClass* Class = Node->GetClass(); Class; Class = Class->GetSuperClass())
+        {
+            if (Class->GetFName() == NodeClassName)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+FName FUnrealMCPCommonUtils::GetNodeMemberName(const UEdGraphNode* Node)
+{
+    if (const UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(Node))
+    {
+        return FunctionNode->FunctionReference.GetMemberName();
+    }
+    if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        // Custom events are named by CustomFunctionName, overrides by their event reference
+        return EventNode->GetFunctionName();
+    }
+    if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+    {
+        return VariableNode->GetVarName();
+    }
+    return NAME_None;
+}
+
+TArray<UEdGraphNode*> FUnrealMCPCommonUtils::FindNodes(UBlueprint* Blueprint, const FName& NodeClassName, const FName& MemberName)
+{
+    TArray<UEdGraphNode*> Result;
+    if (!Blueprint)
+    {
+        return Result;
+    }
+
+    TSharedPtr<FMCPNodeIndex>* ExistingIndex = NodeIndices.Find(Blueprint);
+    if (!ExistingIndex)
+    {
+        for (auto It = NodeIndices.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        // Structural changes (renamed members, added or removed graphs) are broadcast through the blueprint
+        TSharedPtr<FMCPNodeIndex> NewIndex = MakeShared<FMCPNodeIndex>();
+        TWeakPtr<FMCPNodeIndex> WeakIndex = NewIndex;
+        NewIndex->BlueprintChangedHandle = Blueprint->OnChanged().AddLambda([WeakIndex](UBlueprint*)
+        {
+            if (TSharedPtr<FMCPNodeIndex> PinnedIndex = WeakIndex.Pin())
+            {
+                PinnedIndex->bDirty = true;
+            }
+        });
+        ExistingIndex = &NodeIndices.Add(Blueprint, NewIndex);
+    }
+    const TSharedPtr<FMCPNodeIndex> Index = *ExistingIndex;
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    Graphs.RemoveAll([](const UEdGraph* Graph) { return Graph == nullptr; });
+    if (!Index->bDirty && Graphs.Num() != Index->Graphs.Num())
+    {
+        Index->bDirty = true;
+    }
+    for (int32 GraphIndex = 0; !Index->bDirty && GraphIndex < Graphs.Num(); ++GraphIndex)
+    {
+        Index->bDirty = Index->Graphs[GraphIndex].Get() != Graphs[GraphIndex];
+    }
+    if (Index->bDirty)
+    {
+        RebuildNodeIndex(Index, Graphs);
+    }
+
+    // Look up by the most selective key, then check the other one
+    TArray<int32> NodeIndexes;
+    if (MemberName != NAME_None)
+    {
+        Index->NodesByMember.MultiFind(MemberName, NodeIndexes, true);
+    }
+    else if (NodeClassName != NAME_None)
+    {
+        Index->NodesByClass.MultiFind(NodeClassName, NodeIndexes, true);
+    }
+    else
+    {
+        NodeIndexes.Reserve(Index->Nodes.Num());
+        for (int32 NodeIndex = 0; NodeIndex < Index->Nodes.Num(); ++NodeIndex)
+        {
+            NodeIndexes.Add(NodeIndex);
+        }
+    }
+
+    for (int32 NodeIndex : NodeIndexes)
+    {
+        UEdGraphNode* Node = Index->Nodes[NodeIndex].Get();
+        if (Node && (MemberName == NAME_None || NodeClassName == NAME_None || IsNodeOfClass(Node, NodeClassName)))
+        {
+            Result.Add(Node);
+        }
+    }
+    return Result;
+}
+
+// Graph layout utilities
+namespace
+{
+    /** Gap between chains of nodes that are not connected to each other, in rows of spacing */
+    constexpr float ComponentGapRows = 4.0f;
+    constexpr int32 LayoutGridSize = 16;
+    constexpr int32 OrderingSweeps = 4;
+
+    /** Rough on-screen size of a node. The real size is only known to the graph panel widgets */
+    FVector2D EstimateNodeSize(const UEdGraphNode* Node)
+    {
+        int32 NumInputs = 0;
+        int32 NumOutputs = 0;
+        int32 LongestInput = 0;
+        int32 LongestOutput = 0;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin->bHidden)
+            {
+                continue;
+            }
+
+            const int32 NameLength = Pin->PinName.GetStringLength();
+            if (Pin->Direction == EGPD_Input)
+            {
+                ++NumInputs;
+                LongestInput = FMath::Max(LongestInput, NameLength);
+            }
+            else
+            {
+                ++NumOutputs;
+                LongestOutput = FMath::Max(LongestOutput, NameLength);
+            }
+        }
+
+        const int32 TitleLength = Node->GetNodeTitle(ENodeTitleType::ListView).ToString().Len();
+        const float Width = FMath::Max3(120.0f, 40.0f + TitleLength * 7.0f, 80.0f + (LongestInput + LongestOutput) * 7.0f);
+        const float Height = 48.0f + 26.0f * FMath::Max(NumInputs, NumOutputs);
+        return FVector2D(Width, Height);
+    }
+
+    int32 SnapToLayoutGrid(double Coordinate)
+    {
+        return FMath::RoundToInt(Coordinate / LayoutGridSize) * LayoutGridSize;
+    }
+
+    FBox2D GetNodeRect(const UEdGraphNode* Node)
+    {
+        const FVector2D Position(Node->NodePosX, Node->NodePosY);
+        return FBox2D(Position, Position + EstimateNodeSize(Node));
+    }
+
+    /** Move Desired down until a node of Size placed there overlaps none of the given rectangles */
+    FVector2D FindFreePosition(const TArray<FBox2D>& OccupiedRects, FVector2D Desired, const FVector2D& Size, float Gap)
+    {
+        for (int32 Attempt = 0; Attempt < 256; ++Attempt)
+        {
+            const FBox2D Candidate(Desired, Desired + Size);
+            const FBox2D* Overlap = OccupiedRects.FindByPredicate([&Candidate, Gap](const FBox2D& Rect)
+            {
+                return Candidate.Min.X < Rect.Max.X + Gap && Rect.Min.X < Candidate.Max.X + Gap &&
+                       Candidate.Min.Y < Rect.Max.Y + Gap && Rect.Min.Y < Candidate.Max.Y + Gap;
+            });
+            if (!Overlap)
+            {
+                break;
+            }
+            Desired.Y = Overlap->Max.Y + Gap;
+        }
+        return Desired;
+    }
+
+    void MoveNodeToFreePosition(UEdGraphNode* Node, const FVector2D& Desired)
+    {
+        TArray<FBox2D> OccupiedRects;
+        for (const UEdGraphNode* Other : Node->GetGraph()->Nodes)
+        {
+            if (Other && Other != Node && !Other->IsA<UEdGraphNode_Comment>())
+            {
+                OccupiedRects.Add(GetNodeRect(Other));
+            }
+        }
+
+        const FVector2D Position = FindFreePosition(OccupiedRects, Desired, EstimateNodeSize(Node), 32.0f);
+        Node->NodePosX = SnapToLayoutGrid(Position.X);
+        Node->NodePosY = SnapToLayoutGrid(Position.Y);
+    }
+
+    bool HasExecPin(const UEdGraphNode* Node, EEdGraphPinDirection Direction)
+    {
+        return Node->Pins.ContainsByPredicate([Direction](const UEdGraphPin* Pin)
+        {
+            return Pin->Direction == Direction && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+        });
+    }
+
+    /** A node of the layered layout, with its links to other laid out nodes */
+    struct FMCPLayoutNode
+    {
+        UEdGraphNode* Node = nullptr;
+        FVector2D Size = FVector2D::ZeroVector;
+        bool bHasExec = false;
+        int32 Component = 0;
+        int32 Layer = 0;
+        double Order = 0.0;
+        double Y = 0.0;
+        TArray<int32> Successors;
+        TArray<int32> Predecessors;
+    };
+
+    int32 FindComponentRoot(TArray<int32>& Parents, int32 Index)
+    {
+        while (Parents[Index] != Index)
+        {
+            Parents[Index] = Parents[Parents[Index]];
+            Index = Parents[Index];
+        }
+        return Index;
+    }
+
+    /**
+     * Drop the links that close cycles so the remaining ones form a DAG. An iterative depth-first search marks each link to a
+     * node still on the stack; sources are visited first so the entry points of each chain keep their outgoing links.
+     */
+    void RemoveCycles(TArray<FMCPLayoutNode>& LayoutNodes)
+    {
+        enum class EVisit : uint8 { New, Active, Done };
+        TArray<EVisit> States;
+        States.Init(EVisit::New, LayoutNodes.Num());
+        TArray<TPair<int32, int32>> BackLinks;
+
+        TArray<int32> Roots;
+        for (int32 Index = 0; Index < LayoutNodes.Num(); ++Index)
+        {
+            if (LayoutNodes[Index].Predecessors.Num() == 0)
+            {
+                Roots.Add(Index);
+            }
+        }
+        for (int32 Index = 0; Index < LayoutNodes.Num(); ++Index)
+        {
+            Roots.Add(Index);
+        }
+
+        TArray<TPair<int32, int32>> Stack;
+        for (int32 Root : Roots)
+        {
+            if (States[Root] != EVisit::New)
+            {
+                continue;
+            }
+
+            States[Root] = EVisit::Active;
+            Stack.Add(TPair<int32, int32>(Root, 0));
+            while (Stack.Num() > 0)
+            {
+                TPair<int32, int32>& Top = Stack.Last();
+                const TArray<int32>& Successors = LayoutNodes[Top.Key].Successors;
+                if (Top.Value >= Successors.Num())
+                {
+                    States[Top.Key] = EVisit::Done;
+                    Stack.Pop(EAllowShrinking::No);
+                    continue;
+                }
+
+                const int32 Next = Successors[Top.Value++];
+                if (States[Next] == EVisit::Active)
+                {
+                    BackLinks.Add(TPair<int32, int32>(Top.Key, Next));
+                }
+                else if (States[Next] == EVisit::New)
+                {
+                    States[Next] = EVisit::Active;
+                    Stack.Add(TPair<int32, int32>(Next, 0));
+                }
+            }
+        }
+
+        for (const TPair<int32, int32>& Link : BackLinks)
+        {
+            LayoutNodes[Link.Key].Successors.RemoveSingleSwap(Link.Value, EAllowShrinking::No);
+            LayoutNodes[Link.Value].Predecessors.RemoveSingleSwap(Link.Key, EAllowShrinking::No);
+        }
+    }
+
+    /**
+     * Longest-path layering in topological order. Pure nodes (no exec pins) are then pulled right, next to the first node
+     * that consumes their output, so getters and math sit beside the node they feed instead of at the start of the chain.
+     */
+    void AssignLayers(TArray<FMCPLayoutNode>& LayoutNodes)
+    {
+        TArray<int32> PendingPredecessors;
+        TArray<int32> TopologicalOrder;
+        PendingPredecessors.SetNumUninitialized(LayoutNodes.Num());
+        TopologicalOrder.Reserve(LayoutNodes.Num());
+        for (int32 Index = 0; Index < LayoutNodes.Num(); ++Index)
+        {
+            PendingPredecessors[Index] = LayoutNodes[Index].Predecessors.Num();
+            if (PendingPredecessors[Index] == 0)
+            {
+                TopologicalOrder.Add(Index);
+            }
+        }
+
+        for (int32 Cursor = 0; Cursor < TopologicalOrder.Num(); ++Cursor)
+        {
+            const FMCPLayoutNode& LayoutNode = LayoutNodes[TopologicalOrder[Cursor]];
+            for (int32 Successor : LayoutNode.Successors)
+            {
+                LayoutNodes[Successor].Layer = FMath::Max(LayoutNodes[Successor].Layer, LayoutNode.Layer + 1);
+                if (--PendingPredecessors[Successor] == 0)
+                {
+                    TopologicalOrder.Add(Successor);
+                }
+            }
+        }
+
+        for (int32 Cursor = TopologicalOrder.Num() - 1; Cursor >= 0; --Cursor)
+        {
+            FMCPLayoutNode& LayoutNode = LayoutNodes[TopologicalOrder[Cursor]];
+            if (LayoutNode.bHasExec || LayoutNode.Successors.Num() == 0)
+            {
+                continue;
+            }
+
+            int32 FirstConsumerLayer = MAX_int32;
+            for (int32 Successor : LayoutNode.Successors)
+            {
+                FirstConsumerLayer = FMath::Min(FirstConsumerLayer, LayoutNodes[Successor].Layer);
+            }
+            LayoutNode.Layer = FMath::Max(LayoutNode.Layer, FirstConsumerLayer - 1);
+        }
+    }
+
+    /** Barycenter crossing reduction: alternately sort each layer by the mean order of the nodes linked from the previous or next layers */
+    void OrderLayers(TArray<FMCPLayoutNode>& LayoutNodes, TArray<TArray<int32>>& Layers)
+    {
+        auto SortLayer = [&LayoutNodes](TArray<int32>& Layer)
+        {
+            Algo::StableSortBy(Layer, [&LayoutNodes](int32 Index) { return LayoutNodes[Index].Order; });
+            for (int32 Position = 0; Position < Layer.Num(); ++Position)
+            {
+                LayoutNodes[Layer[Position]].Order = Position;
+            }
+        };
+
+        for (TArray<int32>& Layer : Layers)
+        {
+            SortLayer(Layer);
+        }
+
+        for (int32 Sweep = 0; Sweep < OrderingSweeps; ++Sweep)
+        {
+            const bool bForward = Sweep % 2 == 0;
+            for (int32 Step = 1; Step < Layers.Num(); ++Step)
+            {
+                TArray<int32>& Layer = Layers[bForward ? Step : Layers.Num() - 1 - Step];
+                for (int32 Index : Layer)
+                {
+                    const TArray<int32>& Neighbours = bForward ? LayoutNodes[Index].Predecessors : LayoutNodes[Index].Successors;
+                    if (Neighbours.Num() > 0)
+                    {
+                        double Sum = 0.0;
+                        for (int32 Neighbour : Neighbours)
+                        {
+                            Sum += LayoutNodes[Neighbour].Order;
+                        }
+                        LayoutNodes[Index].Order = Sum / Neighbours.Num();
+                    }
+                }
+                SortLayer(Layer);
+            }
+        }
+    }
+
+    /** Stack the nodes of a layer in order, each as close to its desired Y as the nodes above it allow */
+    void PackLayer(TArray<FMCPLayoutNode>& LayoutNodes, const TArray<int32>& Layer, const TArray<double>& DesiredY, float RowSpacing)
+    {
+        double NextFreeY = 0.0;
+        for (int32 Position = 0; Position < Layer.Num(); ++Position)
+        {
+            FMCPLayoutNode& LayoutNode = LayoutNodes[Layer[Position]];
+            LayoutNode.Y = FMath::Max(DesiredY[Position], NextFreeY);
+            NextFreeY = LayoutNode.Y + LayoutNode.Size.Y + RowSpacing;
+        }
+    }
+
+    double MeanNeighbourY(const TArray<FMCPLayoutNode>& LayoutNodes, const TArray<int32>& Neighbours, double Fallback)
+    {
+        if (Neighbours.Num() == 0)
+        {
+            return Fallback;
+        }
+
+        double Sum = 0.0;
+        for (int32 Neighbour : Neighbours)
+        {
+            Sum += LayoutNodes[Neighbour].Y;
+        }
+        return Sum / Neighbours.Num();
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::LayoutGraph(UEdGraph* Graph, const FVector2D& Spacing)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    if (!Graph)
+    {
+        return ResultObj;
+    }
+
+    // Comment boxes keep their place; everything else is laid out
+    TArray<FMCPLayoutNode> LayoutNodes;
+    TMap<const UEdGraphNode*, int32> NodeIndices;
+    FVector2D Origin(MAX_flt, MAX_flt);
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (!Node || Node->IsA<UEdGraphNode_Comment>())
+        {
+            continue;
+        }
+
+        FMCPLayoutNode& LayoutNode = LayoutNodes.AddDefaulted_GetRef();
+        LayoutNode.Node = Node;
+        LayoutNode.Size = EstimateNodeSize(Node);
+        LayoutNode.bHasExec = HasExecPin(Node, EGPD_Input) || HasExecPin(Node, EGPD_Output);
+        LayoutNode.Order = Node->NodePosY;
+        NodeIndices.Add(Node, LayoutNodes.Num() - 1);
+        Origin.X = FMath::Min(Origin.X, static_cast<float>(Node->NodePosX));
+        Origin.Y = FMath::Min(Origin.Y, static_cast<float>(Node->NodePosY));
+    }
+
+    if (LayoutNodes.Num() == 0)
+    {
+        ResultObj->SetNumberField(TEXT("node_count"), 0);
+        return ResultObj;
+    }
+
+    // Exec and data links both run from output to input pins
+    TArray<int32> ComponentParents;
+    ComponentParents.SetNumUninitialized(LayoutNodes.Num());
+    for (int32 Index = 0; Index < LayoutNodes.Num(); ++Index)
+    {
+        ComponentParents[Index] = Index;
+    }
+    for (int32 Index = 0; Index < LayoutNodes.Num(); ++Index)
+    {
+        for (const UEdGraphPin* Pin : LayoutNodes[Index].Node->Pins)
+        {
+            if (Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const int32* Target = LinkedPin ? NodeIndices.Find(LinkedPin->GetOwningNode()) : nullptr;
+                if (Target && *Target != Index && !LayoutNodes[Index].Successors.Contains(*Target))
+                {
+                    LayoutNodes[Index].Successors.Add(*Target);
+                    LayoutNodes[*Target].Predecessors.Add(Index);
+                    ComponentParents[FindComponentRoot(ComponentParents, Index)] = FindComponentRoot(ComponentParents, *Target);
+                }
+            }
+        }
+    }
+
+    RemoveCycles(LayoutNodes);
+    AssignLayers(LayoutNodes);
+
+    // Lay out each connected chain on its own, then stack the chains in their original top to bottom order
+    TMap<int32, int32> ComponentIds;
+    TArray<TArray<int32>> Components;
+    for (int32 Index = 0; Index < LayoutNodes.Num(); ++Index)
+    {
+        const int32 Root = FindComponentRoot(ComponentParents, Index);
+        int32* ComponentId = ComponentIds.Find(Root);
+        if (!ComponentId)
+        {
+            ComponentId = &ComponentIds.Add(Root, Components.Num());
+            Components.AddDefaulted();
+        }
+        LayoutNodes[Index].Component = *ComponentId;
+        Components[*ComponentId].Add(Index);
+    }
+
+    TArray<int32> ComponentOrder;
+    TArray<double> ComponentTops;
+    for (int32 ComponentId = 0; ComponentId < Components.Num(); ++ComponentId)
+    {
+        ComponentOrder.Add(ComponentId);
+        double Top = MAX_dbl;
+        for (int32 Index : Components[ComponentId])
+        {
+            Top = FMath::Min(Top, static_cast<double>(LayoutNodes[Index].Node->NodePosY));
+        }
+        ComponentTops.Add(Top);
+    }
+    Algo::StableSortBy(ComponentOrder, [&ComponentTops](int32 ComponentId) { return ComponentTops[ComponentId]; });
+
+    int32 LayerCount = 0;
+    double ComponentOffsetY = 0.0;
+    for (int32 ComponentId : ComponentOrder)
+    {
+        const TArray<int32>& Members = Components[ComponentId];
+        int32 MinLayer = MAX_int32;
+        int32 MaxLayer = 0;
+        for (int32 Index : Members)
+        {
+            MinLayer = FMath::Min(MinLayer, LayoutNodes[Index].Layer);
+            MaxLayer = FMath::Max(MaxLayer, LayoutNodes[Index].Layer);
+        }
+
+        TArray<TArray<int32>> Layers;
+        Layers.SetNum(MaxLayer - MinLayer + 1);
+        for (int32 Index : Members)
+        {
+            Layers[LayoutNodes[Index].Layer - MinLayer].Add(Index);
+        }
+        LayerCount = FMath::Max(LayerCount, Layers.Num());
+
+        OrderLayers(LayoutNodes, Layers);
+
+        // Left to right, nodes line up with their predecessors; right to left, nodes without any line up with what they feed
+        TArray<double> DesiredY;
+        for (const TArray<int32>& Layer : Layers)
+        {
+            DesiredY.Reset();
+            for (int32 Index : Layer)
+            {
+                DesiredY.Add(MeanNeighbourY(LayoutNodes, LayoutNodes[Index].Predecessors, 0.0));
+            }
+            PackLayer(LayoutNodes, Layer, DesiredY, Spacing.Y);
+        }
+        for (int32 LayerIndex = Layers.Num() - 1; LayerIndex >= 0; --LayerIndex)
+        {
+            DesiredY.Reset();
+            for (int32 Index : Layers[LayerIndex])
+            {
+                const FMCPLayoutNode& LayoutNode = LayoutNodes[Index];
+                DesiredY.Add(LayoutNode.Predecessors.Num() > 0 ? LayoutNode.Y : MeanNeighbourY(LayoutNodes, LayoutNode.Successors, LayoutNode.Y));
+            }
+            PackLayer(LayoutNodes, Layers[LayerIndex], DesiredY, Spacing.Y);
+        }
+
+        double ColumnX = 0.0;
+        double ComponentHeight = 0.0;
+        for (const TArray<int32>& Layer : Layers)
+        {
+            double ColumnWidth = 0.0;
+            for (int32 Index : Layer)
+            {
+                FMCPLayoutNode& LayoutNode = LayoutNodes[Index];
+                LayoutNode.Node->NodePosX = SnapToLayoutGrid(Origin.X + ColumnX);
+                LayoutNode.Node->NodePosY = SnapToLayoutGrid(Origin.Y + ComponentOffsetY + LayoutNode.Y);
+                ColumnWidth = FMath::Max(ColumnWidth, static_cast<double>(LayoutNode.Size.X));
+                ComponentHeight = FMath::Max(ComponentHeight, LayoutNode.Y + LayoutNode.Size.Y);
+            }
+            ColumnX += ColumnWidth + Spacing.X;
+        }
+        ComponentOffsetY += ComponentHeight + Spacing.Y * ComponentGapRows;
+    }
+
+    Graph->NotifyGraphChanged();
+
+    ResultObj->SetNumberField(TEXT("node_count"), LayoutNodes.Num());
+    ResultObj->SetNumberField(TEXT("chain_count"), Components.Num());
+    ResultObj->SetNumberField(TEXT("layer_count"), LayerCount);
+    ResultObj->SetNumberField(TEXT("layout_time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
+
+bool FUnrealMCPCommonUtils::AutoPlaceNode(UEdGraphNode* Node)
+{
+    UEdGraph* Graph = Node ? Node->GetGraph() : nullptr;
+    if (!Graph)
+    {
+        return false;
+    }
+
+    if (PlaceNextToLinkedNode(Node))
+    {
+        return true;
+    }
+
+    // Not connected to anything yet: start a new row below the graph
+    float GraphLeft = MAX_flt;
+    float GraphBottom = -MAX_flt;
+    for (const UEdGraphNode* Other : Graph->Nodes)
+    {
+        if (!Other || Other == Node || Other->IsA<UEdGraphNode_Comment>())
+        {
+            continue;
+        }
+
+        const FBox2D Rect = GetNodeRect(Other);
+        GraphLeft = FMath::Min(GraphLeft, Rect.Min.X);
+        GraphBottom = FMath::Max(GraphBottom, Rect.Max.Y);
+    }
+
+    const FVector2D Desired = GraphLeft == MAX_flt ? FVector2D::ZeroVector : FVector2D(GraphLeft, GraphBottom + 128.0f);
+    MoveNodeToFreePosition(Node, Desired);
+    return false;
+}
+
+bool FUnrealMCPCommonUtils::PlaceNextToLinkedNode(UEdGraphNode* Node)
+{
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        const UEdGraphPin* LinkedPin = Pin->LinkedTo.Num() > 0 ? Pin->LinkedTo[0] : nullptr;
+        const UEdGraphNode* Neighbour = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+        if (!Neighbour || Neighbour == Node)
+        {
+            continue;
+        }
+
+        // Inputs come from the left and outputs feed to the right, as the layout places them
+        const FBox2D NeighbourRect = GetNodeRect(Neighbour);
+        if (Pin->Direction == EGPD_Input)
+        {
+            MoveNodeToFreePosition(Node, FVector2D(NeighbourRect.Max.X + 80.0f, NeighbourRect.Min.Y));
+        }
+        else
+        {
+            MoveNodeToFreePosition(Node, FVector2D(NeighbourRect.Min.X - EstimateNodeSize(Node).X - 80.0f, NeighbourRect.Min.Y + 48.0f));
+        }
+        return true;
+    }
+    return false;
+}
+
+// Component node utilities
+namespace
+{
+    /** Variable name to node map for one construction script, kept until the script or one of its nodes is modified */
+    struct FMCPSCSNodeIndex
+    {
+        bool bDirty = true;
+        int32 NodeCount = INDEX_NONE;
+        TMap<FName, TWeakObjectPtr<USCS_Node>> Nodes;
+    };
+
+    TMap<TWeakObjectPtr<USimpleConstructionScript>, FMCPSCSNodeIndex> SCSNodeIndices;
+    FDelegateHandle SCSIndexObjectModifiedHandle;
+    FDelegateHandle SCSIndexPropertyChangedHandle;
+
+    /** Adding, removing and reparenting nodes modify the script; renames modify the node, which is outered to it */
+    void InvalidateSCSNodeIndex(UObject* Object)
+    {
+        if (SCSNodeIndices.Num() == 0 || !Object)
+        {
+            return;
+        }
+
+        USimpleConstructionScript* SCS = Cast<USimpleConstructionScript>(Object);
+        if (!SCS && Object->IsA<USCS_Node>())
+        {
+            SCS = Object->GetTypedOuter<USimpleConstructionScript>();
+        }
+        if (FMCPSCSNodeIndex* Index = SCS ? SCSNodeIndices.Find(SCS) : nullptr)
+        {
+            Index->bDirty = true;
+        }
+    }
+
+    void RebuildSCSNodeIndex(USimpleConstructionScript* SCS, FMCPSCSNodeIndex& Index)
+    {
+        const TArray<USCS_Node*>& AllNodes = SCS->GetAllNodes();
+        Index.bDirty = false;
+        Index.NodeCount = AllNodes.Num();
+        Index.Nodes.Reset();
+        for (USCS_Node* Node : AllNodes)
+        {
+            if (Node)
+            {
+                Index.Nodes.Add(Node->GetVariableName(), Node);
+            }
+        }
+    }
+}
+
+USCS_Node* FUnrealMCPCommonUtils::FindSCSNode(USimpleConstructionScript* SCS, const FName& VariableName)
+{
+    if (!SCS)
+    {
+        return nullptr;
+    }
+
+    FMCPSCSNodeIndex* Index = SCSNodeIndices.Find(SCS);
+    if (!Index)
+    {
+        if (!SCSIndexObjectModifiedHandle.IsValid())
+        {
+            SCSIndexObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddStatic(&InvalidateSCSNodeIndex);
+            SCSIndexPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject* Object, FPropertyChangedEvent&)
+            {
+                InvalidateSCSNodeIndex(Object);
+            });
+        }
+
+        // Drop indices of construction scripts that have been garbage collected
+        for (auto It = SCSNodeIndices.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        Index = &SCSNodeIndices.Add(SCS);
+    }
+
+    // The node count still catches edits that skipped Modify; otherwise the index is only rebuilt after a change
+    if (Index->bDirty || Index->NodeCount != SCS->GetAllNodes().Num())
+    {
+        RebuildSCSNodeIndex(SCS, *Index);
+    }
+
+    // A miss in a current index is a real miss; a hit whose name changed means a rename went unreported
+    const TWeakObjectPtr<USCS_Node>* Found = Index->Nodes.Find(VariableName);
+    USCS_Node* Node = Found ? Found->Get() : nullptr;
+    if (Found && (!Node || Node->GetVariableName() != VariableName))
+    {
+        RebuildSCSNodeIndex(SCS, *Index);
+        Found = Index->Nodes.Find(VariableName);
+        Node = Found ? Found->Get() : nullptr;
+    }
+
+    return Node && Node->GetVariableName() == VariableName ? Node : nullptr;
+}
+
+void FUnrealMCPCommonUtils::ClearSCSNodeIndices()
+{
+    SCSNodeIndices.Reset();
+    FCoreUObjectDelegates::OnObjectModified.Remove(SCSIndexObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(SCSIndexPropertyChangedHandle);
+    SCSIndexObjectModifiedHandle.Reset();
+    SCSIndexPropertyChangedHandle.Reset();
+}
+
+// Blueprint node utilities
+UK2Node_Event* FUnrealMCPCommonUtils::CreateEventNode(UEdGraph* Graph, const FString& EventName, const FVector2D& Position)
+{
+    if (!Graph)
+    {
+        return nullptr;
+    }
+    
+    UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
+    if (!Blueprint)
+    {
+        return nullptr;
+    }
+    
+    // Check for existing event node with this exact name
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+        if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
+        {
+            UE_LOG(LogTemp, Display, TEXT("Using existing event node with name %s (ID: %s)"), 
+                *EventName, *EventNode->NodeGuid.ToString());
+            return EventNode;
+        }
+    }
+
+    // No existing node found, create a new one
+    UK2Node_Event* EventNode = nullptr;
+    
+    // Find the function to create the event
+    UClass* BlueprintClass = Blueprint->GeneratedClass;
+    UFunction* EventFunction = BlueprintClass->FindFunctionByName(FName(*EventName));
+    
+    if (EventFunction)
+    {
+        EventNode = NewObject<UK2Node_Event>(Graph);
+        EventNode->EventReference.SetExternalMember(FName(*EventName), BlueprintClass);
+        EventNode->NodePosX = Position.X;
+        EventNode->NodePosY = Position.Y;
+        Graph->AddNode(EventNode, true);
+        EventNode->PostPlacedNewNode();
+        EventNode->AllocateDefaultPins();
+        UE_LOG(LogTemp, Display, TEXT("Created new event node with name %s (ID: %s)"), 
+            *EventName, *EventNode->NodeGuid.ToString());
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to find function for event name: %s"), *EventName);
+    }
+    
+    return EventNode;
+}
+
+UK2Node_CallFunction* FUnrealMCPCommonUtils::CreateFunctionCallNode(UEdGraph* Graph, UFunction* Function, const FVector2D& Position)
+{
+    if (!Graph || !Function)
+    {
+        return nullptr;
+    }
+    
+    UK2Node_CallFunction* FunctionNode = NewObject<UK2Node_CallFunction>(Graph);
+    FunctionNode->SetFromFunction(Function);
+    FunctionNode->NodePosX = Position.X;
+    FunctionNode->NodePosY = Position.Y;
+    Graph->AddNode(FunctionNode, true);
+    FunctionNode->CreateNewGuid();
+    FunctionNode->PostPlacedNewNode();
+    FunctionNode->AllocateDefaultPins();
+    
+    return FunctionNode;
+}
+
+UK2Node_VariableGet* FUnrealMCPCommonUtils::CreateVariableGetNode(UEdGraph* Graph, UBlueprint* Blueprint, const FString& VariableName, const FVector2D& Position)
+{
+    if (!Graph || !Blueprint)
+    {
+        return nullptr;
+    }
+    
+    UK2Node_VariableGet* VariableGetNode = NewObject<UK2Node_VariableGet>(Graph);
+    
+    FName VarName(*VariableName);
+    FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
+    
+    if (Property)
+    {
+        VariableGetNode->VariableReference.SetFromField<FProperty>(Property, false);
+        VariableGetNode->NodePosX = Position.X;
+        VariableGetNode->NodePosY = Position.Y;
+        Graph->AddNode(VariableGetNode, true);
+        VariableGetNode->PostPlacedNewNode();
+        VariableGetNode->AllocateDefaultPins();
+        
+        return VariableGetNode;
+    }
+    
+    return nullptr;
+}
+
+UK2Node_VariableSet* FUnrealMCPCommonUtils::CreateVariableSetNode(UEdGraph* Graph, UBlueprint* Blueprint, const FString& VariableName, const FVector2D& Position)
+{
+    if (!Graph || !Blueprint)
+    {
+        return nullptr;
+    }
+    
+    UK2Node_VariableSet* VariableSetNode = NewObject<UK2Node_VariableSet>(Graph);
+    
+    FName VarName(*VariableName);
+    FProperty* Property = FindFProperty<FProperty>(Blueprint->GeneratedClass, VarName);
+    
+    if (Property)
+    {
+        VariableSetNode->VariableReference.SetFromField<FProperty>(Property, false);
+        VariableSetNode->NodePosX = Position.X;
+        VariableSetNode->NodePosY = Position.Y;
+        Graph->AddNode(VariableSetNode, true);
+        VariableSetNode->PostPlacedNewNode();
+        VariableSetNode->AllocateDefaultPins();
+        
+        return VariableSetNode;
+    }
+    
+    return nullptr;
+}
+
+UK2Node_InputAction* FUnrealMCPCommonUtils::CreateInputActionNode(UEdGraph* Graph, const FString& ActionName, const FVector2D& Position)
+{
+    if (!Graph)
+    {
+        return nullptr;
+    }
+    
+    UK2Node_InputAction* InputActionNode = NewObject<UK2Node_InputAction>(Graph);
+    InputActionNode->InputActionName = FName(*ActionName);
+    InputActionNode->NodePosX = Position.X;
+    InputActionNode->NodePosY = Position.Y;
+    Graph->AddNode(InputActionNode, true);
+    InputActionNode->CreateNewGuid();
+    InputActionNode->PostPlacedNewNode();
+    InputActionNode->AllocateDefaultPins();
+    
+    return InputActionNode;
+}
+
+UK2Node_Self* FUnrealMCPCommonUtils::CreateSelfReferenceNode(UEdGraph* Graph, const FVector2D& Position)
+{
+    if (!Graph)
+    {
+        return nullptr;
+    }
+    
+    UK2Node_Self* SelfNode = NewObject<UK2Node_Self>(Graph);
+    SelfNode->NodePosX = Position.X;
+    SelfNode->NodePosY = Position.Y;
+    Graph->AddNode(SelfNode, true);
+    SelfNode->CreateNewGuid();
+    SelfNode->PostPlacedNewNode();
+    SelfNode->AllocateDefaultPins();
+    
+    return SelfNode;
+}
+
+bool FUnrealMCPCommonUtils::ConnectGraphNodes(UEdGraph* Graph, UEdGraphNode* SourceNode, const FString& SourcePinName, 
+                                           UEdGraphNode* TargetNode, const FString& TargetPinName)
+{
+    if (!Graph || !SourceNode || !TargetNode)
+    {
+        return false;
+    }
+    
+    UEdGraphPin* SourcePin = FindPin(SourceNode, SourcePinName, EGPD_Output);
+    UEdGraphPin* TargetPin = FindPin(TargetNode, TargetPinName, EGPD_Input);
+    
+    if (SourcePin && TargetPin)
+    {
+        SourcePin->MakeLinkTo(TargetPin);
+        return true;
+    }
+    
+    return false;
+}
+
+UEdGraphPin* FUnrealMCPCommonUtils::FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
+{
+    if (!Node)
+    {
+        return nullptr;
+    }
+    
+    // Log all pins for debugging
+    UE_LOG(LogTemp, Display, TEXT("FindPin: Looking for pin '%s' (Direction: %d) in node '%s'"), 
+           *PinName, (int32)Direction, *Node->GetName());
+    
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        UE_LOG(LogTemp, Display, TEXT("  - Available pin: '%s', Direction: %d, Category: %s"), 
+               *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
+    }
+    
+    // First try exact match
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin->PinName.ToString() == PinName && (Direction == EGPD_MAX || Pin->Direction == Direction))
+        {
+            UE_LOG(LogTemp, Display, TEXT("  - Found exact matching pin: '%s'"), *Pin->PinName.ToString());
+            return Pin;
+        }
+    }
+    
+    // If no exact match and we're looking for a component reference, try case-insensitive match
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin->PinName.ToString().Equals(PinName, ESearchCase::IgnoreCase) && 
+            (Direction == EGPD_MAX || Pin->Direction == Direction))
+        {
+            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive matching pin: '%s'"), *Pin->PinName.ToString());
+            return Pin;
+        }
+    }
+    
+    // If we're looking for a component output and didn't find it by name, try to find the first data output pin
+    if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(Node) != nullptr)
+    {
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+            {
+                UE_LOG(LogTemp, Display, TEXT("  - Found fallback data output pin: '%s'"), *Pin->PinName.ToString());
+                return Pin;
+            }
+        }
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("  - No matching pin found for '%s'"), *PinName);
+    return nullptr;
+}
+
+// Actor utilities
+TSharedPtr<FJsonValue> FUnrealMCPCommonUtils::ActorToJson(AActor* Actor)
+{
+    if (!Actor)
+    {
+        return MakeShared<FJsonValueNull>();
+    }
+    
+    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+    ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+    ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+    
+    FVector Location = Actor->GetActorLocation();
+    TArray<TSharedPtr<FJsonValue>> LocationArray;
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.X));
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Y));
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Z));
+    ActorObject->SetArrayField(TEXT("location"), LocationArray);
+    
+    FRotator Rotation = Actor->GetActorRotation();
+    TArray<TSharedPtr<FJsonValue>> RotationArray;
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Pitch));
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Yaw));
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Roll));
+    ActorObject->SetArrayField(TEXT("rotation"), RotationArray);
+    
+    FVector Scale = Actor->GetActorScale3D();
+    TArray<TSharedPtr<FJsonValue>> ScaleArray;
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.X));
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
+    ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
+    
+    return MakeShared<FJsonValueObject>(ActorObject);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::ActorToJsonObject(AActor* Actor, bool bDetailed)
+{
+    if (!Actor)
+    {
+        return nullptr;
+    }
+    
+    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+    ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+    ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+    
+    FVector Location = Actor->GetActorLocation();
+    TArray<TSharedPtr<FJsonValue>> LocationArray;
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.X));
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Y));
+    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Z));
+    ActorObject->SetArrayField(TEXT("location"), LocationArray);
+    
+    FRotator Rotation = Actor->GetActorRotation();
+    TArray<TSharedPtr<FJsonValue>> RotationArray;
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Pitch));
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Yaw));
+    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Roll));
+    ActorObject->SetArrayField(TEXT("rotation"), RotationArray);
+    
+    FVector Scale = Actor->GetActorScale3D();
+    TArray<TSharedPtr<FJsonValue>> ScaleArray;
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.X));
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
+    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
+    ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
+    
+    return ActorObject;
+}
+
+UK2Node_Event* FUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
+{
+    if (!Graph)
+    {
+        return nullptr;
+    }
+
+    // Look for existing event nodes
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+        if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
+        {
+            UE_LOG(LogTemp, Display, TEXT("Found existing event node with name: %s"), *EventName);
+            return EventNode;
+        }
+    }
+
+    return nullptr;
+}
+
+// Property path utilities
+namespace
+{
+    /** One step of a property path. Index is a static or dynamic array index, or INDEX_NONE */
+    struct FMCPPropertyPathSegment
+    {
+        FProperty* Property = nullptr;
+        int32 Index = INDEX_NONE;
+    };
+
+    /** A path resolved against one class; RemainingPath continues inside the object referenced by the last segment */
+    struct FMCPCachedPropertyPath
+    {
+        TWeakObjectPtr<UClass> Class;
+        TArray<FMCPPropertyPathSegment> Segments;
+        FString RemainingPath;
+    };
+
+    /** An exported property of a class or struct, with its JSON key and category built once */
+    struct FMCPPropertyLayoutEntry
+    {
+        FProperty* Property = nullptr;
+        FString JsonKey;
+        FString Category;
+    };
+
+    struct FMCPPropertyLayout
+    {
+        TWeakObjectPtr<const UStruct> Struct;
+        TArray<FMCPPropertyLayoutEntry> Entries;
+    };
+
+    TMap<TPair<const UClass*, FString>, FMCPCachedPropertyPath> PropertyPathCache;
+    TMap<const UStruct*, TSharedRef<FMCPPropertyLayout>> PropertyLayoutCache;
+    FDelegateHandle ReflectionCacheCompiledHandle;
+
+    bool IsNativeStruct(const UStruct* Struct)
+    {
+        if (const UClass* Class = Cast<UClass>(Struct))
+        {
+            return Class->HasAnyClassFlags(CLASS_Native);
+        }
+        if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Struct))
+        {
+            return (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+        }
+        return false;
+    }
+
+    void InvalidateBlueprintReflectionCaches()
+    {
+        // Recompiling a blueprint rebuilds the properties of its generated class (and of user defined structs), so
+        // any cached chain or layout of a non-native type may now point at destroyed FProperty instances
+        for (auto It = PropertyPathCache.CreateIterator(); It; ++It)
+        {
+            const UClass* Class = It.Value().Class.Get();
+            if (!Class || !IsNativeStruct(Class))
+            {
+                It.RemoveCurrent();
+            }
+        }
+        for (auto It = PropertyLayoutCache.CreateIterator(); It; ++It)
+        {
+            const UStruct* Struct = It.Value()->Struct.Get();
+            if (!Struct || !IsNativeStruct(Struct))
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    void RegisterReflectionCacheInvalidation()
+    {
+        if (!ReflectionCacheCompiledHandle.IsValid() && GEditor)
+        {
+            ReflectionCacheCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&InvalidateBlueprintReflectionCaches);
+        }
+    }
+
+    bool ParsePathSegment(const FString& Segment, FString& OutName, int32& OutIndex)
+    {
+        OutIndex = INDEX_NONE;
+
+        int32 BracketIndex;
+        if (!Segment.FindChar(TEXT('['), BracketIndex))
+        {
+            OutName = Segment;
+            return !OutName.IsEmpty();
+        }
+
+        if (!Segment.EndsWith(TEXT("]")))
+        {
+            return false;
+        }
+
+        OutName = Segment.Left(BracketIndex);
+        const FString IndexString = Segment.Mid(BracketIndex + 1, Segment.Len() - BracketIndex - 2);
+        if (OutName.IsEmpty() || IndexString.IsEmpty() || !IndexString.IsNumeric())
+        {
+            return false;
+        }
+
+        OutIndex = FCString::Atoi(*IndexString);
+        return OutIndex >= 0;
+    }
+
+    bool BuildPropertyPath(const UClass* Class, const FString& PropertyPath, FMCPCachedPropertyPath& OutPath, FString& OutErrorMessage)
+    {
+        TArray<FString> Segments;
+        PropertyPath.ParseIntoArray(Segments, TEXT("."));
+        if (Segments.Num() == 0)
+        {
+            OutErrorMessage = TEXT("Empty property path");
+            return false;
+        }
+
+        const UStruct* Scope = Class;
+        for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+        {
+            FString Name;
+            int32 Index;
+            if (!ParsePathSegment(Segments[SegmentIndex], Name, Index))
+            {
+                OutErrorMessage = FString::Printf(TEXT("Invalid segment '%s' in property path '%s'"), *Segments[SegmentIndex], *PropertyPath);
+                return false;
+            }
+
+            FProperty* Property = FindFProperty<FProperty>(Scope, *Name);
+            if (!Property)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *Name);
+                return false;
+            }
+
+            FProperty* ValueProperty = Property;
+            if (Index != INDEX_NONE)
+            {
+                if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+                {
+                    ValueProperty = ArrayProp->Inner;
+                }
+                else if (Property->ArrayDim > 1)
+                {
+                    if (Index >= Property->ArrayDim)
+                    {
+                        OutErrorMessage = FString::Printf(TEXT("Index %d out of range for %s (size %d)"), Index, *Name, Property->ArrayDim);
+                        return false;
+                    }
+                }
+                else
+                {
+                    OutErrorMessage = FString::Printf(TEXT("Property %s is not an array"), *Name);
+                    return false;
+                }
+            }
+
+            FMCPPropertyPathSegment& PathSegment = OutPath.Segments.AddDefaulted_GetRef();
+            PathSegment.Property = Property;
+            PathSegment.Index = Index;
+
+            if (SegmentIndex == Segments.Num() - 1)
+            {
+                break;
+            }
+
+            if (FStructProperty* StructProp = CastField<FStructProperty>(ValueProperty))
+            {
+                Scope = StructProp->Struct;
+            }
+            else if (CastField<FObjectPropertyBase>(ValueProperty))
+            {
+                // The referenced object's class is only known per instance, so the rest is resolved (and cached) against it
+                for (int32 RemainingIndex = SegmentIndex + 1; RemainingIndex < Segments.Num(); ++RemainingIndex)
+                {
+                    if (!OutPath.RemainingPath.IsEmpty())
+                    {
+                        OutPath.RemainingPath += TEXT(".");
+                    }
+                    OutPath.RemainingPath += Segments[RemainingIndex];
+                }
+                break;
+            }
+            else
+            {
+                OutErrorMessage = FString::Printf(TEXT("Property %s is neither a struct nor an object reference"), *Name);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool WalkPropertyPath(UObject* Object, const FMCPCachedPropertyPath& Path, FMCPResolvedProperty& OutResolved, FString& OutErrorMessage)
+    {
+        void* Container = Object;
+        FProperty* ValueProperty = nullptr;
+        void* ValuePtr = nullptr;
+
+        for (const FMCPPropertyPathSegment& Segment : Path.Segments)
+        {
+            FArrayProperty* ArrayProp = Segment.Index != INDEX_NONE ? CastField<FArrayProperty>(Segment.Property) : nullptr;
+            if (ArrayProp)
+            {
+                FScriptArrayHelper ArrayHelper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(Container));
+                if (!ArrayHelper.IsValidIndex(Segment.Index))
+                {
+                    OutErrorMessage = FString::Printf(TEXT("Index %d out of range for %s (size %d)"),
+                        Segment.Index, *ArrayProp->GetName(), ArrayHelper.Num());
+                    return false;
+                }
+                ValuePtr = ArrayHelper.GetRawPtr(Segment.Index);
+                ValueProperty = ArrayProp->Inner;
+            }
+            else
+            {
+                ValuePtr = Segment.Property->ContainerPtrToValuePtr<void>(Container, FMath::Max(Segment.Index, 0));
+                ValueProperty = Segment.Property;
+            }
+            Container = ValuePtr;
+        }
+
+        if (!Path.RemainingPath.IsEmpty())
+        {
+            FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(ValueProperty);
+            UObject* SubObject = ObjectProp ? ObjectProp->GetObjectPropertyValue(ValuePtr) : nullptr;
+            if (!SubObject)
+            {
+                OutErrorMessage = FString::Printf(TEXT("Object property %s is null"), *ValueProperty->GetName());
+                return false;
+            }
+            return FUnrealMCPCommonUtils::ResolvePropertyPath(SubObject, Path.RemainingPath, OutResolved, OutErrorMessage);
+        }
+
+        OutResolved.Property = ValueProperty;
+        OutResolved.ValuePtr = ValuePtr;
+        OutResolved.Owner = Object;
+        return true;
+    }
+
+    /** Components that are not reachable through a property: actor instance components and SCS templates of a blueprint CDO */
+    UObject* FindPathRootSubobject(UObject* Object, const FString& Name)
+    {
+        const FName ComponentName(*Name);
+
+        if (AActor* Actor = Cast<AActor>(Object))
+        {
+            for (UActorComponent* Component : Actor->GetComponents())
+            {
+                if (Component && Component->GetFName() == ComponentName)
+                {
+                    return Component;
+                }
+            }
+        }
+
+        if (Object->HasAnyFlags(RF_ClassDefaultObject))
+        {
+            UBlueprintGeneratedClass* BlueprintClass = Cast<UBlueprintGeneratedClass>(Object->GetClass());
+            if (BlueprintClass && BlueprintClass->SimpleConstructionScript)
+            {
+                if (USCS_Node* Node = FUnrealMCPCommonUtils::FindSCSNode(BlueprintClass->SimpleConstructionScript, ComponentName))
+                {
+                    return Node->ComponentTemplate;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+bool FUnrealMCPCommonUtils::ResolvePropertyPath(UObject* Object, const FString& PropertyPath,
+                                                FMCPResolvedProperty& OutResolved, FString& OutErrorMessage)
+{
+    if (!Object)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    RegisterReflectionCacheInvalidation();
+
+    FString RootName;
+    FString RemainingPath;
+    const bool bHasRemainingPath = PropertyPath.Split(TEXT("."), &RootName, &RemainingPath);
+
+    // Components of a blueprint CDO live on SCS nodes, the CDO's own component properties are null
+    if (bHasRemainingPath && Object->HasAnyFlags(RF_ClassDefaultObject))
+    {
+        if (UObject* ComponentTemplate = FindPathRootSubobject(Object, RootName))
+        {
+            return ResolvePropertyPath(ComponentTemplate, RemainingPath, OutResolved, OutErrorMessage);
+        }
+    }
+
+    UClass* Class = Object->GetClass();
+    const TPair<const UClass*, FString> CacheKey(Class, PropertyPath);
+
+    FMCPCachedPropertyPath* CachedPath = PropertyPathCache.Find(CacheKey);
+    if (CachedPath && CachedPath->Class.Get() != Class)
+    {
+        // The class this entry was built for has been garbage collected and its address reused
+        PropertyPathCache.Remove(CacheKey);
+        CachedPath = nullptr;
+    }
+
+    if (!CachedPath)
+    {
+        FMCPCachedPropertyPath NewPath;
+        NewPath.Class = Class;
+        if (!BuildPropertyPath(Class, PropertyPath, NewPath, OutErrorMessage))
+        {
+            // The first segment may name a component that isn't exposed as a property
+            if (bHasRemainingPath)
+            {
+                if (UObject* Component = FindPathRootSubobject(Object, RootName))
+                {
+                    return ResolvePropertyPath(Component, RemainingPath, OutResolved, OutErrorMessage);
+                }
+            }
+            return false;
+        }
+        CachedPath = &PropertyPathCache.Add(CacheKey, MoveTemp(NewPath));
+    }
+
+    return WalkPropertyPath(Object, *CachedPath, OutResolved, OutErrorMessage);
+}
+
+bool FUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
+                                     const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
+    if (!Object)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    FMCPResolvedProperty Resolved;
+    if (!ResolvePropertyPath(Object, PropertyName, Resolved, OutErrorMessage))
+    {
+        return false;
+    }
+
+    return SetPropertyValue(Resolved.Property, Resolved.ValuePtr, Resolved.Owner, Value, OutErrorMessage);
+}
+
+bool FUnrealMCPCommonUtils::UpdateObjectProperty(UObject* Object, const FString& PropertyPath,
+                                       const TSharedPtr<FJsonValue>& Value, bool& bOutChanged, FString& OutErrorMessage)
+{
+    bOutChanged = false;
+    if (!Object)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    FMCPResolvedProperty Resolved;
+    if (!ResolvePropertyPath(Object, PropertyPath, Resolved, OutErrorMessage))
+    {
+        return false;
+    }
+
+    // Compare the exported value before and after, since JSON values don't map one to one onto property values
+    FString OldValue;
+    Resolved.Property->ExportTextItem_Direct(OldValue, Resolved.ValuePtr, nullptr, Resolved.Owner, PPF_None);
+    if (!SetPropertyValue(Resolved.Property, Resolved.ValuePtr, Resolved.Owner, Value, OutErrorMessage))
+    {
+        return false;
+    }
+
+    FString NewValue;
+    Resolved.Property->ExportTextItem_Direct(NewValue, Resolved.ValuePtr, nullptr, Resolved.Owner, PPF_None);
+    bOutChanged = !OldValue.Equals(NewValue, ESearchCase::CaseSensitive);
+    return true;
+}
+
+bool FUnrealMCPCommonUtils::SetPropertyValue(FProperty* Property, void* PropertyAddr, UObject* Owner,
+                                    const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
+    if (!Property || !PropertyAddr || !Value.IsValid())
+    {
+        OutErrorMessage = TEXT("Invalid property or value");
+        return false;
+    }
+
+    const FString PropertyName = Property->GetName();
+    
+    // Handle different property types
+    if (Property->IsA<FBoolProperty>())
+    {
+        ((FBoolProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsBool());
+        return true;
+    }
+    else if (Property->IsA<FIntProperty>())
+    {
+        int32 IntValue = static_cast<int32>(Value->AsNumber());
+        FIntProperty* IntProperty = CastField<FIntProperty>(Property);
+        if (IntProperty)
+        {
+            IntProperty->SetPropertyValue(PropertyAddr, IntValue);
+            return true;
+        }
+    }
+    else if (Property->IsA<FFloatProperty>())
+    {
+        ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
+        return true;
+    }
+    else if (Property->IsA<FDoubleProperty>())
+    {
+        ((FDoubleProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
+        return true;
+    }
+    else if (Property->IsA<FStrProperty>())
+    {
+        ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
+        return true;
+    }
+    else if (Property->IsA<FNameProperty>())
+    {
+        ((FNameProperty*)Property)->SetPropertyValue(PropertyAddr, FName(*Value->AsString()));
+        return true;
+    }
+    else if (Property->IsA<FTextProperty>())
+    {
+        ((FTextProperty*)Property)->SetPropertyValue(PropertyAddr, FText::FromString(Value->AsString()));
+        return true;
+    }
+    else if (Property->IsA<FByteProperty>())
+    {
+        FByteProperty* ByteProp = CastField<FByteProperty>(Property);
+        UEnum* EnumDef = ByteProp ? ByteProp->GetIntPropertyEnum() : nullptr;
+        
+        // If this is a TEnumAsByte property (has associated enum)
+        if (EnumDef)
+        {
+            // Handle numeric value
+            if (Value->Type == EJson::Number)
+            {
+                uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
+                ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
+                
+                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
+                      *PropertyName, ByteValue);
+                return true;
+            }
+            // Handle string enum value
+            else if (Value->Type == EJson::String)
+            {
+                FString EnumValueName = Value->AsString();
+                
+                // Try to convert numeric string to number first
+                if (EnumValueName.IsNumeric())
+                {
+                    uint8 ByteValue = FCString::Atoi(*EnumValueName);
+                    ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
+                    
+                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
+                          *PropertyName, *EnumValueName, ByteValue);
+                    return true;
+                }
+                
+                // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
+                if (EnumValueName.Contains(TEXT("::")))
+                {
+                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
+                }
+                
+                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
+                if (EnumValue == INDEX_NONE)
+                {
+                    // Try with full name as fallback
+                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
+                }
+                
+                if (EnumValue != INDEX_NONE)
+                {
+                    ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
+                    
+                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
+                          *PropertyName, *EnumValueName, EnumValue);
+                    return true;
+                }
+                else
+                {
+                    // Log all possible enum values for debugging
+                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
+                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
+                    {
+                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
+                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
+                    }
+                    
+                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            // Regular byte property
+            uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
+            ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
+            return true;
+        }
+    }
+    else if (Property->IsA<FEnumProperty>())
+    {
+        FEnumProperty* EnumProp = CastField<FEnumProperty>(Property);
+        UEnum* EnumDef = EnumProp ? EnumProp->GetEnum() : nullptr;
+        FNumericProperty* UnderlyingNumericProp = EnumProp ? EnumProp->GetUnderlyingProperty() : nullptr;
+        
+        if (EnumDef && UnderlyingNumericProp)
+        {
+            // Handle numeric value
+            if (Value->Type == EJson::Number)
+            {
+                int64 EnumValue = static_cast<int64>(Value->AsNumber());
+                UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
+                
+                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
+                      *PropertyName, EnumValue);
+                return true;
+            }
+            // Handle string enum value
+            else if (Value->Type == EJson::String)
+            {
+                FString EnumValueName = Value->AsString();
+                
+                // Try to convert numeric string to number first
+                if (EnumValueName.IsNumeric())
+                {
+                    int64 EnumValue = FCString::Atoi64(*EnumValueName);
+                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
+                    
+                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
+                          *PropertyName, *EnumValueName, EnumValue);
+                    return true;
+                }
+                
+                // Handle qualified enum names
+                if (EnumValueName.Contains(TEXT("::")))
+                {
+                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
+                }
+                
+                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
+                if (EnumValue == INDEX_NONE)
+                {
+                    // Try with full name as fallback
+                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
+                }
+                
+                if (EnumValue != INDEX_NONE)
+                {
+                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
+                    
+                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
+                          *PropertyName, *EnumValueName, EnumValue);
+                    return true;
+                }
+                else
+                {
+                    // Log all possible enum values for debugging
+                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
+                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
+                    {
+                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
+                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
+                    }
+                    
+                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Structs, object references and other types can still be set from their exported text form
+    if (Value->Type == EJson::String && Property->ImportText_Direct(*Value->AsString(), PropertyAddr, Owner, PPF_None) != nullptr)
+    {
+        return true;
+    }
+    
     OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"), 
                                     *Property->GetClass()->GetName(), *PropertyName);
     return false;
-} 
\ No newline at end of file
+}
+
+// Property export utilities
+namespace
+{
+    TSharedRef<FMCPPropertyLayout> GetPropertyLayout(const UStruct* Struct)
+    {
+        if (const TSharedRef<FMCPPropertyLayout>* CachedLayout = PropertyLayoutCache.Find(Struct))
+        {
+            if ((*CachedLayout)->Struct.Get() == Struct)
+            {
+                return *CachedLayout;
+            }
+        }
+
+        TSharedRef<FMCPPropertyLayout> Layout = MakeShared<FMCPPropertyLayout>();
+        Layout->Struct = Struct;
+
+        // Classes only expose what the details panel would show, struct members are exported in full
+        const bool bEditableOnly = Struct->IsA<UClass>();
+        for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+        {
+            FProperty* Property = *PropIt;
+            if (Property->HasAnyPropertyFlags(CPF_Deprecated) || (bEditableOnly && !Property->HasAnyPropertyFlags(CPF_Edit)))
+            {
+                continue;
+            }
+
+            FMCPPropertyLayoutEntry& Entry = Layout->Entries.AddDefaulted_GetRef();
+            Entry.Property = Property;
+            Entry.JsonKey = Property->GetAuthoredName();
+            Entry.Category = Property->GetMetaData(TEXT("Category"));
+        }
+
+        PropertyLayoutCache.Add(Struct, Layout);
+        return Layout;
+    }
+
+    bool MatchesCategoryFilter(const FString& Category, const TArray<FString>& Categories)
+    {
+        if (Categories.Num() == 0)
+        {
+            return true;
+        }
+
+        for (const FString& Filter : Categories)
+        {
+            // "Physics" also matches nested categories such as "Physics|Advanced"
+            if (Category.Equals(Filter, ESearchCase::IgnoreCase) ||
+                Category.StartsWith(Filter + TEXT("|"), ESearchCase::IgnoreCase))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TSharedPtr<FJsonValue> ContainerPropertyToJson(FProperty* Property, const void* Container, int32 MaxDepth)
+    {
+        if (Property->ArrayDim == 1)
+        {
+            return FUnrealMCPCommonUtils::PropertyValueToJson(Property, Property->ContainerPtrToValuePtr<void>(Container), MaxDepth);
+        }
+
+        TArray<TSharedPtr<FJsonValue>> Elements;
+        for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+        {
+            Elements.Add(FUnrealMCPCommonUtils::PropertyValueToJson(Property, Property->ContainerPtrToValuePtr<void>(Container, Index), MaxDepth));
+        }
+        return MakeShared<FJsonValueArray>(Elements);
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::PropertiesToJson(UObject* Object, int32 MaxDepth, const TArray<FString>& Categories)
+{
+    TSharedPtr<FJsonObject> PropertiesObject = MakeShared<FJsonObject>();
+    if (!Object)
+    {
+        return PropertiesObject;
+    }
+
+    RegisterReflectionCacheInvalidation();
+
+    const TSharedRef<FMCPPropertyLayout> Layout = GetPropertyLayout(Object->GetClass());
+    for (const FMCPPropertyLayoutEntry& Entry : Layout->Entries)
+    {
+        if (MatchesCategoryFilter(Entry.Category, Categories))
+        {
+            PropertiesObject->SetField(Entry.JsonKey, ContainerPropertyToJson(Entry.Property, Object, MaxDepth));
+        }
+    }
+
+    return PropertiesObject;
+}
+
+TSharedPtr<FJsonValue> FUnrealMCPCommonUtils::PropertyValueToJson(FProperty* Property, const void* ValuePtr, int32 MaxDepth)
+{
+    if (!Property || !ValuePtr)
+    {
+        return MakeShared<FJsonValueNull>();
+    }
+
+    if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+    {
+        return MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(ValuePtr));
+    }
+    else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+    {
+        const int64 EnumValue = EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+        return MakeShared<FJsonValueString>(EnumProp->GetEnum()->GetNameStringByValue(EnumValue));
+    }
+    else if (FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+    {
+        if (UEnum* EnumDef = NumericProp->GetIntPropertyEnum())
+        {
+            return MakeShared<FJsonValueString>(EnumDef->GetNameStringByValue(NumericProp->GetSignedIntPropertyValue(ValuePtr)));
+        }
+        if (NumericProp->IsFloatingPoint())
+        {
+            return MakeShared<FJsonValueNumber>(NumericProp->GetFloatingPointPropertyValue(ValuePtr));
+        }
+        return MakeShared<FJsonValueNumber>(static_cast<double>(NumericProp->GetSignedIntPropertyValue(ValuePtr)));
+    }
+    else if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+    {
+        return MakeShared<FJsonValueString>(StrProp->GetPropertyValue(ValuePtr));
+    }
+    else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+    {
+        return MakeShared<FJsonValueString>(NameProp->GetPropertyValue(ValuePtr).ToString());
+    }
+    else if (FTextProperty* TextProp = CastField<FTextProperty>(Property))
+    {
+        return MakeShared<FJsonValueString>(TextProp->GetPropertyValue(ValuePtr).ToString());
+    }
+    else if (FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Property))
+    {
+        UObject* ObjectValue = ObjectProp->GetObjectPropertyValue(ValuePtr);
+        if (!ObjectValue)
+        {
+            return MakeShared<FJsonValueNull>();
+        }
+        return MakeShared<FJsonValueString>(ObjectValue->GetPathName());
+    }
+    else if (MaxDepth > 0)
+    {
+        if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+        {
+            TSharedPtr<FJsonObject> StructObject = MakeShared<FJsonObject>();
+            const TSharedRef<FMCPPropertyLayout> Layout = GetPropertyLayout(StructProp->Struct);
+            for (const FMCPPropertyLayoutEntry& Entry : Layout->Entries)
+            {
+                StructObject->SetField(Entry.JsonKey, ContainerPropertyToJson(Entry.Property, ValuePtr, MaxDepth - 1));
+            }
+            return MakeShared<FJsonValueObject>(StructObject);
+        }
+        else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+        {
+            FScriptArrayHelper ArrayHelper(ArrayProp, ValuePtr);
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            Elements.Reserve(ArrayHelper.Num());
+            for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+            {
+                Elements.Add(PropertyValueToJson(ArrayProp->Inner, ArrayHelper.GetRawPtr(Index), MaxDepth - 1));
+            }
+            return MakeShared<FJsonValueArray>(Elements);
+        }
+        else if (FSetProperty* SetProp = CastField<FSetProperty>(Property))
+        {
+            FScriptSetHelper SetHelper(SetProp, ValuePtr);
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+            {
+                if (SetHelper.IsValidIndex(Index))
+                {
+                    Elements.Add(PropertyValueToJson(SetProp->ElementProp, SetHelper.GetElementPtr(Index), MaxDepth - 1));
+                }
+            }
+            return MakeShared<FJsonValueArray>(Elements);
+        }
+        else if (FMapProperty* MapProp = CastField<FMapProperty>(Property))
+        {
+            FScriptMapHelper MapHelper(MapProp, ValuePtr);
+            TSharedPtr<FJsonObject> MapObject = MakeShared<FJsonObject>();
+            for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+            {
+                if (MapHelper.IsValidIndex(Index))
+                {
+                    FString KeyString;
+                    MapProp->KeyProp->ExportTextItem_Direct(KeyString, MapHelper.GetKeyPtr(Index), nullptr, nullptr, PPF_None);
+                    MapObject->SetField(KeyString, PropertyValueToJson(MapProp->ValueProp, MapHelper.GetValuePtr(Index), MaxDepth - 1));
+                }
+            }
+            return MakeShared<FJsonValueObject>(MapObject);
+        }
+    }
+
+    // Anything else, or containers beyond the requested depth, are exported in their text form
+    FString TextValue;
+    Property->ExportTextItem_Direct(TextValue, ValuePtr, nullptr, nullptr, PPF_None);
+    return MakeShared<FJsonValueString>(TextValue);
+}
+
+// Asset creation utilities
+bool FUnrealMCPCommonUtils::FindAssetForCreate(const FString& PackageName, const FString& AssetName, UClass* AssetClass, UObject*& OutAsset, FString& OutErrorMessage)
+{
+    OutAsset = nullptr;
+
+    // Objects in memory first: a new asset isn't in the registry until it is announced, and one being deleted may still
+    // hold its name. Garbage isn't excluded from the search so it can be reported instead of replaced.
+    UObject* Existing = nullptr;
+    if (UPackage* Package = FindPackage(nullptr, *PackageName))
+    {
+        Existing = StaticFindObjectFast(UObject::StaticClass(), Package, FName(*AssetName), false, RF_NoFlags, EInternalObjectFlags::None);
+    }
+
+    if (!Existing)
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(PackageName + TEXT(".") + AssetName));
+        if (!AssetData.IsValid())
+        {
+            return true;
+        }
+        if (!AssetData.IsInstanceOf(AssetClass))
+        {
+            OutErrorMessage = FString::Printf(TEXT("%s exists and is not a %s"), *PackageName, *AssetClass->GetName());
+            return false;
+        }
+        Existing = AssetData.GetAsset();
+        if (!Existing)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Failed to load %s"), *PackageName);
+            return false;
+        }
+    }
+
+    if (!IsValid(Existing))
+    {
+        OutErrorMessage = FString::Printf(TEXT("%s is being deleted; try again after it has been garbage collected"), *PackageName);
+        return false;
+    }
+    if (!Existing->IsA(AssetClass))
+    {
+        OutErrorMessage = FString::Printf(TEXT("%s exists and is not a %s"), *PackageName, *AssetClass->GetName());
+        return false;
+    }
+    OutAsset = Existing;
+    return true;
+}
+
+bool FUnrealMCPCommonUtils::ResolveAssetPackage(const FString& AssetName, FName& OutPackageName, FString& OutErrorMessage)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    if (AssetName.StartsWith(TEXT("/")))
+    {
+        const FString PackageName = FPackageName::ObjectPathToPackageName(AssetName);
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssetsByPackageName(FName(*PackageName), Assets);
+        if (Assets.Num() == 0 && !PackageName.StartsWith(TEXT("/Script/")))
+        {
+            OutErrorMessage = WithNameSuggestions(FString::Printf(TEXT("Asset not found: %s"), *AssetName), FPackageName::GetShortName(PackageName), TEXT("asset"));
+            return false;
+        }
+        OutPackageName = FName(*PackageName);
+        return true;
+    }
+
+    TArray<FName> Packages;
+    AssetRegistry.EnumerateAllAssets([&AssetName, &Packages](const FAssetData& Asset)
+    {
+        if (Asset.AssetName.ToString().Equals(AssetName, ESearchCase::IgnoreCase))
+        {
+            Packages.AddUnique(Asset.PackageName);
+        }
+        return true;
+    });
+    if (Packages.Num() == 0)
+    {
+        OutErrorMessage = WithNameSuggestions(FString::Printf(TEXT("Asset not found: %s"), *AssetName), AssetName, TEXT("asset"));
+        return false;
+    }
+    if (Packages.Num() > 1)
+    {
+        TArray<FString> PackageNames;
+        for (const FName& Package : Packages)
+        {
+            PackageNames.Add(Package.ToString());
+        }
+        OutErrorMessage = FString::Printf(TEXT("Asset name '%s' is ambiguous, use one of: %s"), *AssetName, *FString::Join(PackageNames, TEXT(", ")));
+        return false;
+    }
+    OutPackageName = Packages[0];
+    return true;
+}
+
+bool FUnrealMCPCommonUtils::GetPrimaryAsset(const FName& PackageName, FAssetData& OutAsset)
+{
+    TArray<FAssetData> PackageAssets;
+    FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().GetAssetsByPackageName(PackageName, PackageAssets);
+    const FString ShortName = FPackageName::GetShortName(PackageName);
+    const FAssetData* PrimaryAsset = PackageAssets.FindByPredicate([&ShortName](const FAssetData& Asset) { return Asset.AssetName.ToString() == ShortName; });
+    if (!PrimaryAsset)
+    {
+        return false;
+    }
+    OutAsset = *PrimaryAsset;
+    return true;
+}
+
+UObject* FUnrealMCPCommonUtils::LoadResolvedAsset(const FString& AssetName, UClass* AssetClass, FString& OutErrorMessage)
+{
+    FName PackageName;
+    FAssetData AssetData;
+    if (!ResolveAssetPackage(AssetName, PackageName, OutErrorMessage))
+    {
+        return nullptr;
+    }
+    if (!GetPrimaryAsset(PackageName, AssetData))
+    {
+        OutErrorMessage = FString::Printf(TEXT("No asset in package %s"), *PackageName.ToString());
+        return nullptr;
+    }
+
+    UObject* Asset = AssetData.GetAsset();
+    if (!Asset || !Asset->IsA(AssetClass))
+    {
+        OutErrorMessage = FString::Printf(TEXT("%s is not a %s"), *AssetName, *AssetClass->GetName());
+        return nullptr;
+    }
+    return Asset;
+}
+
+// Asset save utilities
+namespace
+{
+    /** How long a queued save waits for further changes to the same package before it is written */
+    constexpr float AssetSaveCoalesceDelay = 0.5f;
+
+    TArray<TWeakObjectPtr<UPackage>> QueuedPackageSaves;
+    FTSTicker::FDelegateHandle AssetSaveTickerHandle;
+
+    // Outcome of the saves since the last flush
+    TArray<FString> SavedPackages;
+    TArray<FString> FailedPackageSaves;
+
+    void SaveQueuedPackages()
+    {
+        TArray<TWeakObjectPtr<UPackage>> QueuedPackages = MoveTemp(QueuedPackageSaves);
+        QueuedPackageSaves.Reset();
+
+        TArray<UPackage*> Packages;
+        for (const TWeakObjectPtr<UPackage>& PackagePtr : QueuedPackages)
+        {
+            if (UPackage* Package = PackagePtr.Get())
+            {
+                Packages.Add(Package);
+            }
+        }
+        if (Packages.Num() == 0)
+        {
+            return;
+        }
+
+        // Checkout has to happen on the game thread before anything is written; one request covers the whole batch
+        if (ISourceControlModule::Get().IsEnabled())
+        {
+            FEditorFileUtils::CheckoutPackages(Packages, nullptr, false);
+        }
+
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        for (UPackage* Package : Packages)
+        {
+            const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(),
+                Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+            if (PlatformFile.IsReadOnly(*Filename))
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to save package %s: %s is read-only"), *Package->GetName(), *Filename);
+                FailedPackageSaves.Add(Package->GetName());
+                continue;
+            }
+
+            // Serialization happens here; SAVE_Async hands the file write itself to a worker thread
+            FSavePackageArgs SaveArgs;
+            SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+            SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+            SaveArgs.Error = GWarn;
+            if (UPackage::Save(Package, Package->FindAssetInPackage(), *Filename, SaveArgs).Result == ESavePackageResult::Success)
+            {
+                SavedPackages.Add(Package->GetName());
+            }
+            else
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to save package: %s"), *Package->GetName());
+                FailedPackageSaves.Add(Package->GetName());
+            }
+        }
+    }
+}
+
+void FUnrealMCPCommonUtils::QueueAssetSave(UObject* Asset)
+{
+    if (!Asset)
+    {
+        return;
+    }
+
+    QueuedPackageSaves.AddUnique(Asset->GetPackage());
+    if (!AssetSaveTickerHandle.IsValid())
+    {
+        AssetSaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+        {
+            // Retry next tick rather than save in the middle of a GC or another save
+            if (IsGarbageCollecting() || GIsSavingPackage)
+            {
+                return true;
+            }
+
+            AssetSaveTickerHandle.Reset();
+            SaveQueuedPackages();
+            return false;
+        }), AssetSaveCoalesceDelay);
+    }
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPCommonUtils::FlushAssetSaves()
+{
+    if (AssetSaveTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(AssetSaveTickerHandle);
+        AssetSaveTickerHandle.Reset();
+    }
+
+    // Callers rely on the files being on disk (shutdown, source control submits), so wait for the worker's writes
+    SaveQueuedPackages();
+    UPackage::WaitForAsyncFileWrites();
+
+    TArray<TSharedPtr<FJsonValue>> SavedArray;
+    for (const FString& PackageName : SavedPackages)
+    {
+        SavedArray.Add(MakeShared<FJsonValueString>(PackageName));
+    }
+    TArray<TSharedPtr<FJsonValue>> FailedArray;
+    for (const FString& PackageName : FailedPackageSaves)
+    {
+        FailedArray.Add(MakeShared<FJsonValueString>(PackageName));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("saved"), SavedArray);
+    ResultObj->SetArrayField(TEXT("failed"), FailedArray);
+    ResultObj->SetBoolField(TEXT("success"), FailedPackageSaves.Num() == 0);
+    if (FailedPackageSaves.Num() > 0)
+    {
+        ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to save packages: %s"), *FString::Join(FailedPackageSaves, TEXT(", "))));
+    }
+
+    SavedPackages.Reset();
+    FailedPackageSaves.Reset();
+    return ResultObj;
+}
+
+// Name suggestion utilities
+namespace
+{
+    /** Asset and class names by trigram, for ranking near misses such as "Cube" for "SM_Cube" */
+    struct FMCPNameIndex
+    {
+        struct FEntry
+        {
+            FString Name;
+            FString Path;
+            FString Kind;
+            FString Key;
+            int32 TrigramCount = 0;
+            bool bRemoved = false;
+        };
+
+        TArray<FEntry> Entries;
+        TMap<FString, int32> EntryByPath;
+        TMap<uint64, TArray<int32>> Postings;
+        TSet<FString> ClassPaths;
+        int32 LiveCount = 0;
+
+        /** Trigrams of the lower-cased name with word boundaries at both ends, so short names still get some */
+        static void GetTrigrams(const FString& Key, TSet<uint64>& OutTrigrams)
+        {
+            const FString Padded = TEXT("\x01") + Key + TEXT("\x01");
+            for (int32 Index = 0; Index + 2 < Padded.Len(); ++Index)
+            {
+                OutTrigrams.Add((uint64(Padded[Index]) << 32) | (uint64(Padded[Index + 1]) << 16) | uint64(Padded[Index + 2]));
+            }
+        }
+
+        void Add(const FString& Name, const FString& Path, const FString& Kind)
+        {
+            if (EntryByPath.Contains(Path))
+            {
+                return;
+            }
+
+            const int32 EntryIndex = Entries.AddDefaulted();
+            FEntry& Entry = Entries[EntryIndex];
+            Entry.Name = Name;
+            Entry.Path = Path;
+            Entry.Kind = Kind;
+            Entry.Key = Name.ToLower();
+
+            TSet<uint64> Trigrams;
+            GetTrigrams(Entry.Key, Trigrams);
+            Entry.TrigramCount = Trigrams.Num();
+            for (uint64 Trigram : Trigrams)
+            {
+                Postings.FindOrAdd(Trigram).Add(EntryIndex);
+            }
+            EntryByPath.Add(Path, EntryIndex);
+            if (Kind == TEXT("class"))
+            {
+                ClassPaths.Add(Path);
+            }
+            ++LiveCount;
+        }
+
+        /** Removed entries stay in the postings and are skipped when ranking, until they outnumber the live ones */
+        void Remove(const FString& Path)
+        {
+            int32 EntryIndex = INDEX_NONE;
+            if (EntryByPath.RemoveAndCopyValue(Path, EntryIndex))
+            {
+                Entries[EntryIndex].bRemoved = true;
+                ClassPaths.Remove(Path);
+                --LiveCount;
+            }
+
+            if (Entries.Num() - LiveCount > FMath::Max(LiveCount, 1024))
+            {
+                Compact();
+            }
+        }
+
+        /** Drop removed entries and renumber the rest; trigrams are kept, so no name is re-split */
+        void Compact()
+        {
+            TArray<int32> NewIndices;
+            NewIndices.SetNumUninitialized(Entries.Num());
+            TArray<FEntry> LiveEntries;
+            LiveEntries.Reserve(LiveCount);
+            for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+            {
+                NewIndices[EntryIndex] = Entries[EntryIndex].bRemoved ? INDEX_NONE : LiveEntries.Add(MoveTemp(Entries[EntryIndex]));
+            }
+            Entries = MoveTemp(LiveEntries);
+
+            for (auto It = Postings.CreateIterator(); It; ++It)
+            {
+                TArray<int32>& Posting = It.Value();
+                for (int32& EntryIndex : Posting)
+                {
+                    EntryIndex = NewIndices[EntryIndex];
+                }
+                Posting.Remove(INDEX_NONE);
+                if (Posting.Num() == 0)
+                {
+                    It.RemoveCurrent();
+                }
+            }
+            for (TPair<FString, int32>& Entry : EntryByPath)
+            {
+                Entry.Value = NewIndices[Entry.Value];
+            }
+        }
+    };
+
+    struct FMCPNameRecord
+    {
+        FString Name;
+        FString Path;
+        FString Kind;
+    };
+
+    TSharedPtr<FMCPNameIndex> NameIndex;
+    TFuture<TSharedPtr<FMCPNameIndex>> NameIndexBuild;
+    TArray<TFunction<void(FMCPNameIndex&)>> PendingNameIndexEdits;
+    bool bNameIndexStarted = false;
+    bool bClassNamesDirty = false;
+    FDelegateHandle NameIndexFilesLoadedHandle;
+    TArray<FDelegateHandle> NameIndexRegistryHandles;
+    FDelegateHandle NameIndexModulesChangedHandle;
+    FDelegateHandle NameIndexBlueprintCompiledHandle;
+    FDelegateHandle NameIndexGarbageCollectHandle;
+
+    /** Registry changes are applied directly once the index exists, and replayed onto it while it is being built */
+    void EditNameIndex(TFunction<void(FMCPNameIndex&)>&& Edit)
+    {
+        if (NameIndex.IsValid())
+        {
+            Edit(*NameIndex);
+        }
+        else if (NameIndexBuild.IsValid())
+        {
+            PendingNameIndexEdits.Add(MoveTemp(Edit));
+        }
+    }
+
+    /** Publish a finished background build; optionally wait for it */
+    bool IsNameIndexReady(bool bWait)
+    {
+        if (!NameIndex.IsValid() && NameIndexBuild.IsValid() && (bWait || NameIndexBuild.IsReady()))
+        {
+            NameIndex = NameIndexBuild.Get();
+            NameIndexBuild = TFuture<TSharedPtr<FMCPNameIndex>>();
+            for (TFunction<void(FMCPNameIndex&)>& Edit : PendingNameIndexEdits)
+            {
+                Edit(*NameIndex);
+            }
+            PendingNameIndexEdits.Empty();
+        }
+        return NameIndex.IsValid();
+    }
+
+    bool IsSuggestableClass(const UClass* Class)
+    {
+        const FString ClassName = Class->GetName();
+        return IsValid(Class) && !Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists)
+            && !ClassName.StartsWith(TEXT("SKEL_")) && !ClassName.StartsWith(TEXT("REINST_")) && !ClassName.StartsWith(TEXT("TRASHCLASS_"));
+    }
+
+    /**
+     * Classes come and go with module loads, blueprint compiles and garbage collection, none of which the registry
+     * reports, so those only mark the class names stale and the next suggestion brings them up to date
+     */
+    void MarkClassNamesDirty()
+    {
+        bClassNamesDirty = true;
+    }
+
+    void SyncClassNames()
+    {
+        bClassNamesDirty = false;
+
+        TSet<FString> CurrentPaths;
+        for (TObjectIterator<UClass> It; It; ++It)
+        {
+            if (IsSuggestableClass(*It))
+            {
+                const FString Path = It->GetPathName();
+                CurrentPaths.Add(Path);
+                NameIndex->Add(It->GetName(), Path, TEXT("class"));
+            }
+        }
+
+        TArray<FString> StalePaths;
+        for (const FString& Path : NameIndex->ClassPaths)
+        {
+            if (!CurrentPaths.Contains(Path))
+            {
+                StalePaths.Add(Path);
+            }
+        }
+        for (const FString& Path : StalePaths)
+        {
+            NameIndex->Remove(Path);
+        }
+    }
+
+    /** Runs once the registry has finished its initial scan, so the enumeration doesn't stall editor startup or see a partial registry */
+    void BuildNameIndex()
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        if (NameIndexFilesLoadedHandle.IsValid())
+        {
+            AssetRegistry.OnFilesLoaded().Remove(NameIndexFilesLoadedHandle);
+            NameIndexFilesLoadedHandle.Reset();
+        }
+
+        // Collect names on the game thread, where the registry and class iteration are safe, and index them on a worker
+        TArray<FMCPNameRecord> Records;
+        AssetRegistry.EnumerateAllAssets([&Records](const FAssetData& Asset)
+        {
+            Records.Add({ Asset.AssetName.ToString(), Asset.GetObjectPathString(), Asset.AssetClassPath.GetAssetName().ToString() });
+            return true;
+        });
+        for (TObjectIterator<UClass> It; It; ++It)
+        {
+            if (IsSuggestableClass(*It))
+            {
+                Records.Add({ It->GetName(), It->GetPathName(), TEXT("class") });
+            }
+        }
+
+        NameIndexBuild = Async(EAsyncExecution::ThreadPool, [Records = MoveTemp(Records)]()
+        {
+            TSharedPtr<FMCPNameIndex> Index = MakeShared<FMCPNameIndex>();
+            for (const FMCPNameRecord& Record : Records)
+            {
+                Index->Add(Record.Name, Record.Path, Record.Kind);
+            }
+            return Index;
+        });
+
+        NameIndexRegistryHandles.Add(AssetRegistry.OnAssetAdded().AddLambda([](const FAssetData& Asset)
+        {
+            EditNameIndex([Name = Asset.AssetName.ToString(), Path = Asset.GetObjectPathString(), Kind = Asset.AssetClassPath.GetAssetName().ToString()](FMCPNameIndex& Index)
+            {
+                Index.Add(Name, Path, Kind);
+            });
+        }));
+        NameIndexRegistryHandles.Add(AssetRegistry.OnAssetRemoved().AddLambda([](const FAssetData& Asset)
+        {
+            EditNameIndex([Path = Asset.GetObjectPathString()](FMCPNameIndex& Index)
+            {
+                Index.Remove(Path);
+            });
+        }));
+        NameIndexRegistryHandles.Add(AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData& Asset, const FString& OldObjectPath)
+        {
+            EditNameIndex([OldObjectPath, Name = Asset.AssetName.ToString(), Path = Asset.GetObjectPathString(), Kind = Asset.AssetClassPath.GetAssetName().ToString()](FMCPNameIndex& Index)
+            {
+                Index.Remove(OldObjectPath);
+                Index.Add(Name, Path, Kind);
+            });
+        }));
+
+        NameIndexModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([](FName, EModuleChangeReason)
+        {
+            MarkClassNamesDirty();
+        });
+        NameIndexGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&MarkClassNamesDirty);
+        if (GEditor)
+        {
+            NameIndexBlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&MarkClassNamesDirty);
+        }
+    }
+}
+
+void FUnrealMCPCommonUtils::StartNameIndexBuild()
+{
+    if (bNameIndexStarted)
+    {
+        return;
+    }
+    bNameIndexStarted = true;
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        NameIndexFilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddStatic(&BuildNameIndex);
+    }
+    else
+    {
+        BuildNameIndex();
+    }
+}
+
+void FUnrealMCPCommonUtils::StopNameIndex()
+{
+    if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        AssetRegistry.OnFilesLoaded().Remove(NameIndexFilesLoadedHandle);
+        if (NameIndexRegistryHandles.Num() == 3)
+        {
+            AssetRegistry.OnAssetAdded().Remove(NameIndexRegistryHandles[0]);
+            AssetRegistry.OnAssetRemoved().Remove(NameIndexRegistryHandles[1]);
+            AssetRegistry.OnAssetRenamed().Remove(NameIndexRegistryHandles[2]);
+        }
+    }
+    NameIndexFilesLoadedHandle.Reset();
+    NameIndexRegistryHandles.Reset();
+
+    FModuleManager::Get().OnModulesChanged().Remove(NameIndexModulesChangedHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(NameIndexGarbageCollectHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(NameIndexBlueprintCompiledHandle);
+    }
+    NameIndexModulesChangedHandle.Reset();
+    NameIndexGarbageCollectHandle.Reset();
+    NameIndexBlueprintCompiledHandle.Reset();
+
+    if (NameIndexBuild.IsValid())
+    {
+        NameIndexBuild.Wait();
+        NameIndexBuild = TFuture<TSharedPtr<FMCPNameIndex>>();
+    }
+    PendingNameIndexEdits.Empty();
+    NameIndex.Reset();
+    bNameIndexStarted = false;
+    bClassNamesDirty = false;
+}
+
+TArray<FMCPNameSuggestion> FUnrealMCPCommonUtils::SuggestNames(const FString& Query, const FString& Kind, int32 MaxResults, bool bWaitForIndex)
+{
+    TArray<FMCPNameSuggestion> Suggestions;
+    StartNameIndexBuild();
+    if (Query.IsEmpty() || !IsNameIndexReady(bWaitForIndex))
+    {
+        return Suggestions;
+    }
+    if (bClassNamesDirty)
+    {
+        SyncClassNames();
+    }
+
+    const FString Key = Query.ToLower();
+    TSet<uint64> QueryTrigrams;
+    FMCPNameIndex::GetTrigrams(Key, QueryTrigrams);
+
+    TMap<int32, int32> SharedTrigrams;
+    for (uint64 Trigram : QueryTrigrams)
+    {
+        if (const TArray<int32>* Posting = NameIndex->Postings.Find(Trigram))
+        {
+            for (int32 EntryIndex : *Posting)
+            {
+                ++SharedTrigrams.FindOrAdd(EntryIndex);
+            }
+        }
+    }
+
+    // "class" and "asset" select a side; anything else names an asset class, with subclasses sharing its suffix
+    // ("Blueprint" covers "WidgetBlueprint")
+    auto MatchesKind = [&Kind](const FMCPNameIndex::FEntry& Entry)
+    {
+        if (Kind.IsEmpty())
+        {
+            return true;
+        }
+        const bool bIsClass = Entry.Kind == TEXT("class");
+        if (Kind == TEXT("class") || Kind == TEXT("asset"))
+        {
+            return bIsClass == (Kind == TEXT("class"));
+        }
+        return !bIsClass && Entry.Kind.EndsWith(Kind, ESearchCase::IgnoreCase);
+    };
+
+    for (const TPair<int32, int32>& Shared : SharedTrigrams)
+    {
+        const FMCPNameIndex::FEntry& Entry = NameIndex->Entries[Shared.Key];
+        if (Entry.bRemoved || !MatchesKind(Entry))
+        {
+            continue;
+        }
+
+        // Dice similarity of the trigram sets, with a boost for containment either way ("Cube" in "SM_Cube")
+        float Score = 2.0f * Shared.Value / (QueryTrigrams.Num() + Entry.TrigramCount);
+        if (Entry.Key == Key)
+        {
+            Score += 1.0f;
+        }
+        else if (Entry.Key.Contains(Key) || Key.Contains(Entry.Key))
+        {
+            Score += 0.5f;
+        }
+        if (Score < 0.3f)
+        {
+            continue;
+        }
+        Suggestions.Add({ Entry.Name, Entry.Path, Entry.Kind, Score });
+    }
+
+    Suggestions.Sort([](const FMCPNameSuggestion& A, const FMCPNameSuggestion& B)
+    {
+        return A.Score > B.Score || (A.Score == B.Score && A.Name.Len() < B.Name.Len());
+    });
+    if (Suggestions.Num() > MaxResults)
+    {
+        Suggestions.SetNum(MaxResults);
+    }
+    return Suggestions;
+}
+
+FString FUnrealMCPCommonUtils::WithNameSuggestions(const FString& Message, const FString& Query, const FString& Kind)
+{
+    // Not-found errors don't wait for a build still in flight
+    const TArray<FMCPNameSuggestion> Suggestions = SuggestNames(Query, Kind, 5, false);
+    if (Suggestions.Num() == 0)
+    {
+        return Message;
+    }
+
+    TArray<FString> Names;
+    for (const FMCPNameSuggestion& Suggestion : Suggestions)
+    {
+        Names.Add(Suggestion.Kind == TEXT("class") ? Suggestion.Name : Suggestion.Path);
+    }
+    return FString::Printf(TEXT("%s. Did you mean: %s?"), *Message, *FString::Join(Names, TEXT(", ")));
+}
+
+FString FUnrealMCPCommonUtils::BlueprintNotFoundError(const FString& BlueprintName)
+{
+    return WithNameSuggestions(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName), BlueprintName, TEXT("Blueprint"));
+}
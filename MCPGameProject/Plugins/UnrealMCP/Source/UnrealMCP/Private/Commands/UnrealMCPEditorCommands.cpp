@@ -21,6 +21,9 @@
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EditorAssetLibrary.h"
+#include "Components/MeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "ScopedTransaction.h"
 
 FUnrealMCPEditorCommands::FUnrealMCPEditorCommands()
 {
@@ -61,6 +64,10 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     {
         return HandleSetActorProperty(Params);
     }
+    else if (CommandType == TEXT("set_actor_materials"))
+    {
+        return HandleSetActorMaterials(Params);
+    }
     // Blueprint actor spawning
     else if (CommandType == TEXT("spawn_blueprint_actor"))
     {
@@ -75,6 +82,11 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& C
     {
         return HandleTakeScreenshot(Params);
     }
+    // Asset saving commands
+    else if (CommandType == TEXT("wait_for_saves"))
+    {
+        return HandleWaitForSaves(Params);
+    }
     
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
 }
@@ -355,8 +367,39 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorProperties(const
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
     }
 
-    // Always return detailed properties for this command
-    return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
+    // Get optional filters
+    int32 Depth = 1;
+    Params->TryGetNumberField(TEXT("depth"), Depth);
+
+    TArray<FString> Categories;
+    Params->TryGetStringArrayField(TEXT("categories"), Categories);
+
+    bool bIncludeComponents = true;
+    Params->TryGetBoolField(TEXT("include_components"), bIncludeComponents);
+
+    TSharedPtr<FJsonObject> ResultObj = FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
+    ResultObj->SetObjectField(TEXT("properties"), FUnrealMCPCommonUtils::PropertiesToJson(TargetActor, Depth, Categories));
+
+    if (bIncludeComponents)
+    {
+        TArray<TSharedPtr<FJsonValue>> ComponentArray;
+        for (UActorComponent* Component : TargetActor->GetComponents())
+        {
+            if (!Component)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> ComponentObj = MakeShared<FJsonObject>();
+            ComponentObj->SetStringField(TEXT("name"), Component->GetName());
+            ComponentObj->SetStringField(TEXT("class"), Component->GetClass()->GetName());
+            ComponentObj->SetObjectField(TEXT("properties"), FUnrealMCPCommonUtils::PropertiesToJson(Component, Depth, Categories));
+            ComponentArray.Add(MakeShared<FJsonValueObject>(ComponentObj));
+        }
+        ResultObj->SetArrayField(TEXT("components"), ComponentArray);
+    }
+
+    return ResultObj;
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const TSharedPtr<FJsonObject>& Params)
@@ -422,6 +465,155 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorProperty(const T
     }
 }
 
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSetActorMaterials(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    const TArray<TSharedPtr<FJsonValue>>* Assignments = nullptr;
+    if (!Params->TryGetArrayField(TEXT("assignments"), Assignments))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'assignments' parameter"));
+    }
+
+    // Look actors up by name and label from one pass over the level instead of one pass per assignment
+    TMap<FString, AActor*> ActorsByName;
+    TArray<AActor*> AllActors;
+    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    for (AActor* Actor : AllActors)
+    {
+        if (Actor)
+        {
+            ActorsByName.Add(Actor->GetName(), Actor);
+            ActorsByName.FindOrAdd(Actor->GetActorLabel(), Actor);
+        }
+    }
+
+    // Each material is resolved once however many assignments use it, the same way create_material_instances resolves
+    // its parents; names that failed keep their error instead of being looked up again
+    TMap<FString, UMaterialInterface*> Materials;
+    TMap<FString, FString> MaterialErrors;
+    auto LoadMaterial = [&Materials, &MaterialErrors](const FString& MaterialName, FString& OutErrorMessage) -> UMaterialInterface*
+    {
+        if (UMaterialInterface** Cached = Materials.Find(MaterialName))
+        {
+            return *Cached;
+        }
+        if (const FString* CachedError = MaterialErrors.Find(MaterialName))
+        {
+            OutErrorMessage = *CachedError;
+            return nullptr;
+        }
+
+        UMaterialInterface* Material = FUnrealMCPCommonUtils::LoadResolvedAsset<UMaterialInterface>(MaterialName, OutErrorMessage);
+        if (!Material)
+        {
+            MaterialErrors.Add(MaterialName, OutErrorMessage);
+            return nullptr;
+        }
+        Materials.Add(MaterialName, Material);
+        return Material;
+    };
+
+    // The whole batch is one undo step
+    const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "SetActorMaterials", "Set Actor Materials"));
+
+    TArray<TSharedPtr<FJsonValue>> Changes;
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    for (int32 AssignmentIndex = 0; AssignmentIndex < Assignments->Num(); ++AssignmentIndex)
+    {
+        auto AddError = [&Errors, AssignmentIndex](const FString& Error)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("[%d] %s"), AssignmentIndex, *Error)));
+        };
+
+        const TSharedPtr<FJsonObject>* AssignmentPtr = nullptr;
+        FString ActorName;
+        FString MaterialName;
+        if (!(*Assignments)[AssignmentIndex]->TryGetObject(AssignmentPtr) ||
+            !(*AssignmentPtr)->TryGetStringField(TEXT("actor"), ActorName) ||
+            !(*AssignmentPtr)->TryGetStringField(TEXT("material"), MaterialName))
+        {
+            AddError(TEXT("Assignment needs 'actor' and 'material'"));
+            continue;
+        }
+        const TSharedPtr<FJsonObject>& Assignment = *AssignmentPtr;
+
+        AActor* Actor = ActorsByName.FindRef(ActorName);
+        if (!Actor)
+        {
+            AddError(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+            continue;
+        }
+
+        FString ErrorMessage;
+        UMaterialInterface* Material = LoadMaterial(MaterialName, ErrorMessage);
+        if (!Material)
+        {
+            AddError(ErrorMessage);
+            continue;
+        }
+
+        // The slot is an index or a slot name, and defaults to the first slot
+        int32 SlotIndex = 0;
+        FString SlotName;
+        const TSharedPtr<FJsonValue> SlotValue = Assignment->TryGetField(TEXT("slot"));
+        if (SlotValue.IsValid() && SlotValue->Type == EJson::String)
+        {
+            SlotName = SlotValue->AsString();
+        }
+        else if (SlotValue.IsValid())
+        {
+            SlotIndex = (int32)SlotValue->AsNumber();
+        }
+
+        // Every mesh component of the actor unless one is named
+        FString ComponentName;
+        Assignment->TryGetStringField(TEXT("component"), ComponentName);
+        TArray<UMeshComponent*> MeshComponents;
+        Actor->GetComponents(MeshComponents);
+        if (!ComponentName.IsEmpty())
+        {
+            MeshComponents.RemoveAll([&ComponentName](const UMeshComponent* Component) { return Component->GetName() != ComponentName; });
+        }
+        if (MeshComponents.Num() == 0)
+        {
+            AddError(ComponentName.IsEmpty() ? FString::Printf(TEXT("%s has no mesh components"), *ActorName)
+                                             : FString::Printf(TEXT("%s has no mesh component named %s"), *ActorName, *ComponentName));
+            continue;
+        }
+
+        for (UMeshComponent* Component : MeshComponents)
+        {
+            const int32 Slot = SlotName.IsEmpty() ? SlotIndex : Component->GetMaterialIndex(FName(*SlotName));
+            if (Slot < 0 || Slot >= Component->GetNumMaterials())
+            {
+                AddError(FString::Printf(TEXT("%s.%s has no material slot %s"), *ActorName, *Component->GetName(),
+                    SlotName.IsEmpty() ? *FString::FromInt(SlotIndex) : *SlotName));
+                continue;
+            }
+            if (Component->GetMaterial(Slot) == Material)
+            {
+                continue;
+            }
+
+            Component->Modify();
+            Component->SetMaterial(Slot, Material);
+
+            TSharedPtr<FJsonObject> ChangeObj = MakeShared<FJsonObject>();
+            ChangeObj->SetStringField(TEXT("actor"), Actor->GetName());
+            ChangeObj->SetStringField(TEXT("component"), Component->GetName());
+            ChangeObj->SetNumberField(TEXT("slot"), Slot);
+            ChangeObj->SetStringField(TEXT("material"), Material->GetPathName());
+            Changes.Add(MakeShared<FJsonValueObject>(ChangeObj));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("changes"), Changes);
+    ResultObj->SetNumberField(TEXT("count"), Changes.Num());
+    ResultObj->SetArrayField(TEXT("errors"), Errors);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -454,7 +646,7 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleSpawnBlueprintActor(cons
     UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *AssetPath);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::BlueprintNotFoundError(BlueprintName));
     }
 
     // Get transform parameters
@@ -623,4 +815,10 @@ TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleTakeScreenshot(const TSh
     }
     
     return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to take screenshot"));
-} 
\ No newline at end of file
+} 
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleWaitForSaves(const TSharedPtr<FJsonObject>& Params)
+{
+    // Barrier for the asset save queue: once this returns, every save requested before it is on disk
+    return FUnrealMCPCommonUtils::FlushAssetSaves();
+}
@@ -1,6 +1,12 @@
 #include "Commands/UnrealMCPProjectCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
 #include "GameFramework/InputSettings.h"
+#include "InputAction.h"
+#include "InputMappingContext.h"
+#include "InputModifiers.h"
+#include "InputTriggers.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/Package.h"
 
 FUnrealMCPProjectCommands::FUnrealMCPProjectCommands()
 {
@@ -12,6 +18,14 @@ TSharedPtr<FJsonObject> FUnrealMCPProjectCommands::HandleCommand(const FString&
     {
         return HandleCreateInputMapping(Params);
     }
+    else if (CommandType == TEXT("create_input_mappings"))
+    {
+        return HandleCreateInputMappings(Params);
+    }
+    else if (CommandType == TEXT("create_enhanced_input"))
+    {
+        return HandleCreateEnhancedInput(Params);
+    }
     
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown project command: %s"), *CommandType));
 }
@@ -69,4 +83,592 @@ TSharedPtr<FJsonObject> FUnrealMCPProjectCommands::HandleCreateInputMapping(cons
     ResultObj->SetStringField(TEXT("action_name"), ActionName);
     ResultObj->SetStringField(TEXT("key"), Key);
     return ResultObj;
-} 
\ No newline at end of file
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPProjectCommands::HandleCreateInputMappings(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    const TArray<TSharedPtr<FJsonValue>>* Mappings = nullptr;
+    if (!Params->TryGetArrayField(TEXT("mappings"), Mappings))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'mappings' parameter"));
+    }
+
+    // Get the input settings
+    UInputSettings* InputSettings = GetMutableDefault<UInputSettings>();
+    if (!InputSettings)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get input settings"));
+    }
+
+    // Existing mappings by everything that distinguishes them, so duplicates are found without rescanning
+    auto ActionMappingId = [](const FInputActionKeyMapping& Mapping)
+    {
+        return FString::Printf(TEXT("Action|%s|%s|%d%d%d%d"), *Mapping.ActionName.ToString(), *Mapping.Key.ToString(),
+            (int32)Mapping.bShift, (int32)Mapping.bCtrl, (int32)Mapping.bAlt, (int32)Mapping.bCmd);
+    };
+    auto AxisMappingId = [](const FInputAxisKeyMapping& Mapping)
+    {
+        return FString::Printf(TEXT("Axis|%s|%s"), *Mapping.AxisName.ToString(), *Mapping.Key.ToString());
+    };
+
+    TSet<FString> ExistingMappings;
+    for (const FInputActionKeyMapping& Mapping : InputSettings->GetActionMappings())
+    {
+        ExistingMappings.Add(ActionMappingId(Mapping));
+    }
+    for (const FInputAxisKeyMapping& Mapping : InputSettings->GetAxisMappings())
+    {
+        ExistingMappings.Add(AxisMappingId(Mapping));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Created;
+    TArray<TSharedPtr<FJsonValue>> Skipped;
+    auto Skip = [&Skipped](const FString& Name, const FString& Key, const FString& Reason)
+    {
+        TSharedPtr<FJsonObject> SkippedObj = MakeShared<FJsonObject>();
+        SkippedObj->SetStringField(TEXT("name"), Name);
+        SkippedObj->SetStringField(TEXT("key"), Key);
+        SkippedObj->SetStringField(TEXT("reason"), Reason);
+        Skipped.Add(MakeShared<FJsonValueObject>(SkippedObj));
+    };
+
+    for (const TSharedPtr<FJsonValue>& MappingValue : *Mappings)
+    {
+        const TSharedPtr<FJsonObject>* Mapping = nullptr;
+        if (!MappingValue->TryGetObject(Mapping))
+        {
+            Skip(FString(), FString(), TEXT("Mapping is not an object"));
+            continue;
+        }
+
+        FString Name;
+        if (!(*Mapping)->TryGetStringField(TEXT("name"), Name) && !(*Mapping)->TryGetStringField(TEXT("action_name"), Name))
+        {
+            Skip(FString(), FString(), TEXT("Missing 'name'"));
+            continue;
+        }
+
+        FString KeyName;
+        (*Mapping)->TryGetStringField(TEXT("key"), KeyName);
+        const FKey Key(*KeyName);
+        if (!Key.IsValid())
+        {
+            Skip(Name, KeyName, TEXT("Unknown key"));
+            continue;
+        }
+
+        FString InputType = TEXT("Action");
+        if (!(*Mapping)->TryGetStringField(TEXT("type"), InputType))
+        {
+            (*Mapping)->TryGetStringField(TEXT("input_type"), InputType);
+        }
+
+        TSharedPtr<FJsonObject> CreatedObj = MakeShared<FJsonObject>();
+        if (InputType.Equals(TEXT("Axis"), ESearchCase::IgnoreCase))
+        {
+            double Scale = 1.0;
+            (*Mapping)->TryGetNumberField(TEXT("scale"), Scale);
+            const FInputAxisKeyMapping AxisMapping(FName(*Name), Key, Scale);
+
+            bool bAlreadyInSet = false;
+            ExistingMappings.Add(AxisMappingId(AxisMapping), &bAlreadyInSet);
+            if (bAlreadyInSet)
+            {
+                Skip(Name, KeyName, TEXT("Duplicate axis mapping"));
+                continue;
+            }
+
+            // Keymaps are rebuilt once after the whole batch
+            InputSettings->AddAxisMapping(AxisMapping, false);
+            CreatedObj->SetNumberField(TEXT("scale"), Scale);
+        }
+        else if (InputType.Equals(TEXT("Action"), ESearchCase::IgnoreCase))
+        {
+            bool bShift = false, bCtrl = false, bAlt = false, bCmd = false;
+            (*Mapping)->TryGetBoolField(TEXT("shift"), bShift);
+            (*Mapping)->TryGetBoolField(TEXT("ctrl"), bCtrl);
+            (*Mapping)->TryGetBoolField(TEXT("alt"), bAlt);
+            (*Mapping)->TryGetBoolField(TEXT("cmd"), bCmd);
+            const FInputActionKeyMapping ActionMapping(FName(*Name), Key, bShift, bCtrl, bAlt, bCmd);
+
+            bool bAlreadyInSet = false;
+            ExistingMappings.Add(ActionMappingId(ActionMapping), &bAlreadyInSet);
+            if (bAlreadyInSet)
+            {
+                Skip(Name, KeyName, TEXT("Duplicate action mapping"));
+                continue;
+            }
+
+            InputSettings->AddActionMapping(ActionMapping, false);
+        }
+        else
+        {
+            Skip(Name, KeyName, FString::Printf(TEXT("Unknown input type: %s"), *InputType));
+            continue;
+        }
+
+        CreatedObj->SetStringField(TEXT("name"), Name);
+        CreatedObj->SetStringField(TEXT("key"), KeyName);
+        CreatedObj->SetStringField(TEXT("type"), InputType);
+        Created.Add(MakeShared<FJsonValueObject>(CreatedObj));
+    }
+
+    // Write the config and rebuild the keymaps once for the whole batch
+    if (Created.Num() > 0)
+    {
+        InputSettings->SaveConfig();
+        InputSettings->ForceRebuildKeymaps();
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("created_count"), Created.Num());
+    ResultObj->SetNumberField(TEXT("skipped_count"), Skipped.Num());
+    ResultObj->SetArrayField(TEXT("created"), Created);
+    ResultObj->SetArrayField(TEXT("skipped"), Skipped);
+    return ResultObj;
+}
+
+namespace
+{
+    /**
+     * Create a trigger or modifier from {"type": "Hold", "HoldTimeThreshold": 0.5} or just "Hold". The type is a class
+     * name with or without its InputTrigger/InputModifier prefix; other fields are set as properties of the new object.
+     */
+    template <typename TInputObject>
+    TInputObject* CreateInputObject(UObject* Outer, const TSharedPtr<FJsonValue>& Spec, const TCHAR* ClassPrefix, FString& OutErrorMessage)
+    {
+        const TSharedPtr<FJsonObject>* SpecObject = nullptr;
+        FString TypeName;
+        if (Spec->TryGetObject(SpecObject))
+        {
+            (*SpecObject)->TryGetStringField(TEXT("type"), TypeName);
+        }
+        else
+        {
+            TypeName = Spec->AsString();
+        }
+
+        UClass* Class = FindFirstObject<UClass>(*(ClassPrefix + TypeName), EFindFirstObjectOptions::NativeFirst);
+        if (!Class)
+        {
+            Class = FindFirstObject<UClass>(*TypeName, EFindFirstObjectOptions::NativeFirst);
+        }
+        if (!Class || !Class->IsChildOf(TInputObject::StaticClass()) || Class->HasAnyClassFlags(CLASS_Abstract))
+        {
+            OutErrorMessage = FString::Printf(TEXT("Unknown %s: %s"), ClassPrefix, *TypeName);
+            return nullptr;
+        }
+
+        TInputObject* InputObject = NewObject<TInputObject>(Outer, Class, NAME_None, RF_Transactional);
+        if (SpecObject)
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : (*SpecObject)->Values)
+            {
+                if (Field.Key != TEXT("type") && !FUnrealMCPCommonUtils::SetObjectProperty(InputObject, Field.Key, Field.Value, OutErrorMessage))
+                {
+                    return nullptr;
+                }
+            }
+        }
+        return InputObject;
+    }
+
+    /** Create the objects listed in Spec's FieldName array; OutObjects stays unset when the field is absent */
+    template <typename TInputObject>
+    bool CreateInputObjects(UObject* Outer, const TSharedPtr<FJsonObject>& Spec, const FString& FieldName, const TCHAR* ClassPrefix,
+        TOptional<TArray<TObjectPtr<TInputObject>>>& OutObjects, FString& OutErrorMessage)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Specs = nullptr;
+        if (!Spec->TryGetArrayField(FieldName, Specs))
+        {
+            return true;
+        }
+
+        TArray<TObjectPtr<TInputObject>> Objects;
+        for (const TSharedPtr<FJsonValue>& ObjectSpec : *Specs)
+        {
+            TInputObject* InputObject = CreateInputObject<TInputObject>(Outer, ObjectSpec, ClassPrefix, OutErrorMessage);
+            if (!InputObject)
+            {
+                return false;
+            }
+            Objects.Add(InputObject);
+        }
+        OutObjects = MoveTemp(Objects);
+        return true;
+    }
+
+    /** Move triggers or modifiers built while validating into the asset that keeps them */
+    template <typename TInputObject>
+    void AdoptInputObjects(UObject* Outer, const TOptional<TArray<TObjectPtr<TInputObject>>>& Objects)
+    {
+        if (Objects.IsSet())
+        {
+            for (TInputObject* InputObject : Objects.GetValue())
+            {
+                InputObject->Rename(nullptr, Outer, REN_DontCreateRedirectors | REN_NonTransactional);
+            }
+        }
+    }
+
+    /** The existing asset to update, looked up in memory and in the registry; null when the asset will be created */
+    template <typename TAsset>
+    bool FindInputAsset(const FString& PackagePath, const FString& AssetName, TAsset*& OutAsset, FString& OutErrorMessage)
+    {
+        UObject* Existing = nullptr;
+        if (!FUnrealMCPCommonUtils::FindAssetForCreate(PackagePath / AssetName, AssetName, TAsset::StaticClass(), Existing, OutErrorMessage))
+        {
+            return false;
+        }
+        OutAsset = Cast<TAsset>(Existing);
+        return true;
+    }
+
+    template <typename TAsset>
+    TAsset* CreateInputAsset(const FString& PackagePath, const FString& AssetName)
+    {
+        UPackage* Package = CreatePackage(*(PackagePath / AssetName));
+        return Package ? NewObject<TAsset>(Package, FName(*AssetName), RF_Public | RF_Standalone | RF_Transactional) : nullptr;
+    }
+
+    struct FInputActionSpec
+    {
+        FString Name;
+        UInputAction* Existing = nullptr;
+        EInputActionValueType ValueType = EInputActionValueType::Boolean;
+        TOptional<FString> Description;
+        TOptional<bool> bConsumeInput;
+        TOptional<TArray<TObjectPtr<UInputTrigger>>> Triggers;
+        TOptional<TArray<TObjectPtr<UInputModifier>>> Modifiers;
+    };
+
+    struct FInputMappingSpec
+    {
+        FString ActionName;
+        FString KeyName;
+        FKey Key;
+        TOptional<TArray<TObjectPtr<UInputTrigger>>> Triggers;
+        TOptional<TArray<TObjectPtr<UInputModifier>>> Modifiers;
+    };
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPProjectCommands::HandleCreateEnhancedInput(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get optional parameters
+    FString PackagePath = TEXT("/Game/Input");
+    Params->TryGetStringField(TEXT("path"), PackagePath);
+    PackagePath.RemoveFromEnd(TEXT("/"));
+
+    bool bOverwrite = false;
+    Params->TryGetBoolField(TEXT("overwrite"), bOverwrite);
+
+    const TArray<TSharedPtr<FJsonValue>>* ActionSpecs = nullptr;
+    Params->TryGetArrayField(TEXT("actions"), ActionSpecs);
+
+    const TSharedPtr<FJsonObject>* ContextSpec = nullptr;
+    Params->TryGetObjectField(TEXT("mapping_context"), ContextSpec);
+
+    if (!ActionSpecs && !ContextSpec)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actions' or 'mapping_context' parameter"));
+    }
+
+    static const TMap<FString, EInputActionValueType> ValueTypes = {
+        { TEXT("Boolean"), EInputActionValueType::Boolean },
+        { TEXT("Axis1D"), EInputActionValueType::Axis1D },
+        { TEXT("Axis2D"), EInputActionValueType::Axis2D },
+        { TEXT("Axis3D"), EInputActionValueType::Axis3D }
+    };
+
+    // Validate the whole spec before any asset is created or changed. Triggers and modifiers are built in the transient
+    // package, so their properties are checked too, and moved into their assets once everything is known to be valid.
+    UObject* TransientOuter = GetTransientPackage();
+    TArray<FInputActionSpec> Actions;
+    TSet<FString> AssetNames;
+    FString ErrorMessage;
+
+    static const TArray<TSharedPtr<FJsonValue>> NoActions;
+    for (const TSharedPtr<FJsonValue>& ActionValue : ActionSpecs ? *ActionSpecs : NoActions)
+    {
+        const TSharedPtr<FJsonObject>* ActionSpecPtr = nullptr;
+        FInputActionSpec& Action = Actions.AddDefaulted_GetRef();
+        if (!ActionValue->TryGetObject(ActionSpecPtr) || !(*ActionSpecPtr)->TryGetStringField(TEXT("name"), Action.Name) || Action.Name.IsEmpty())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Every action needs a 'name'"));
+        }
+        const TSharedPtr<FJsonObject>& ActionSpec = *ActionSpecPtr;
+
+        bool bDuplicate = false;
+        AssetNames.Add(Action.Name, &bDuplicate);
+        if (bDuplicate)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("'%s' appears more than once in the batch"), *Action.Name));
+        }
+        if (!FindInputAsset<UInputAction>(PackagePath, Action.Name, Action.Existing, ErrorMessage))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+        }
+
+        FString ValueTypeName = TEXT("Boolean");
+        ActionSpec->TryGetStringField(TEXT("value_type"), ValueTypeName);
+        if (!ValueTypes.Contains(ValueTypeName))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown value_type '%s' for %s"), *ValueTypeName, *Action.Name));
+        }
+        Action.ValueType = ValueTypes[ValueTypeName];
+
+        FString Description;
+        if (ActionSpec->TryGetStringField(TEXT("description"), Description))
+        {
+            Action.Description = Description;
+        }
+        bool bConsumeInput = true;
+        if (ActionSpec->TryGetBoolField(TEXT("consume_input"), bConsumeInput))
+        {
+            Action.bConsumeInput = bConsumeInput;
+        }
+
+        if (!CreateInputObjects<UInputTrigger>(TransientOuter, ActionSpec, TEXT("triggers"), TEXT("InputTrigger"), Action.Triggers, ErrorMessage) ||
+            !CreateInputObjects<UInputModifier>(TransientOuter, ActionSpec, TEXT("modifiers"), TEXT("InputModifier"), Action.Modifiers, ErrorMessage))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s: %s"), *Action.Name, *ErrorMessage));
+        }
+    }
+
+    FString ContextName;
+    UInputMappingContext* ExistingContext = nullptr;
+    FString ContextDescription;
+    bool bHasContextDescription = false;
+    TArray<FInputMappingSpec> Mappings;
+    TMap<FString, UInputAction*> ExistingActions;
+    if (ContextSpec)
+    {
+        if (!(*ContextSpec)->TryGetStringField(TEXT("name"), ContextName) || ContextName.IsEmpty())
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing mapping_context 'name'"));
+        }
+        if (AssetNames.Contains(ContextName))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("The mapping context and an action are both named '%s'"), *ContextName));
+        }
+        if (!FindInputAsset<UInputMappingContext>(PackagePath, ContextName, ExistingContext, ErrorMessage))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+        }
+        bHasContextDescription = (*ContextSpec)->TryGetStringField(TEXT("description"), ContextDescription);
+
+        const TArray<TSharedPtr<FJsonValue>>* MappingSpecs = nullptr;
+        if ((*ContextSpec)->TryGetArrayField(TEXT("mappings"), MappingSpecs))
+        {
+            for (const TSharedPtr<FJsonValue>& MappingValue : *MappingSpecs)
+            {
+                const TSharedPtr<FJsonObject>* MappingSpec = nullptr;
+                FInputMappingSpec& Mapping = Mappings.AddDefaulted_GetRef();
+                if (!MappingValue->TryGetObject(MappingSpec) || !(*MappingSpec)->TryGetStringField(TEXT("action"), Mapping.ActionName) ||
+                    !(*MappingSpec)->TryGetStringField(TEXT("key"), Mapping.KeyName))
+                {
+                    return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Every mapping needs an 'action' and a 'key'"));
+                }
+
+                // Actions from this batch first, then existing action assets in the same folder
+                if (!AssetNames.Contains(Mapping.ActionName) && !ExistingActions.Contains(Mapping.ActionName))
+                {
+                    UInputAction* ExistingAction = nullptr;
+                    if (!FindInputAsset<UInputAction>(PackagePath, Mapping.ActionName, ExistingAction, ErrorMessage))
+                    {
+                        return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+                    }
+                    if (!ExistingAction)
+                    {
+                        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Input action not found: %s"), *Mapping.ActionName));
+                    }
+                    ExistingActions.Add(Mapping.ActionName, ExistingAction);
+                }
+
+                Mapping.Key = FKey(*Mapping.KeyName);
+                if (!Mapping.Key.IsValid())
+                {
+                    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown key: %s"), *Mapping.KeyName));
+                }
+
+                if (!CreateInputObjects<UInputTrigger>(TransientOuter, *MappingSpec, TEXT("triggers"), TEXT("InputTrigger"), Mapping.Triggers, ErrorMessage) ||
+                    !CreateInputObjects<UInputModifier>(TransientOuter, *MappingSpec, TEXT("modifiers"), TEXT("InputModifier"), Mapping.Modifiers, ErrorMessage))
+                {
+                    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s -> %s: %s"), *Mapping.KeyName, *Mapping.ActionName, *ErrorMessage));
+                }
+            }
+        }
+    }
+
+    // Create the missing assets before changing any existing one, so a failure leaves existing assets untouched.
+    // New assets of a failed batch haven't been announced yet, so moving them out of their packages discards them.
+    TArray<UObject*> CreatedAssets;
+    TArray<UObject*> ModifiedAssets;
+    auto Fail = [&CreatedAssets](const FString& Message)
+    {
+        for (UObject* Asset : CreatedAssets)
+        {
+            Asset->ClearFlags(RF_Public | RF_Standalone);
+            Asset->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+            Asset->MarkAsGarbage();
+        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Message);
+    };
+
+    TMap<FString, UInputAction*> ActionsByName = ExistingActions;
+    for (const FInputActionSpec& Action : Actions)
+    {
+        UInputAction* ActionAsset = Action.Existing ? Action.Existing : CreateInputAsset<UInputAction>(PackagePath, Action.Name);
+        if (!ActionAsset)
+        {
+            return Fail(FString::Printf(TEXT("Failed to create package %s"), *(PackagePath / Action.Name)));
+        }
+        if (!Action.Existing)
+        {
+            CreatedAssets.Add(ActionAsset);
+        }
+        ActionsByName.Add(Action.Name, ActionAsset);
+    }
+
+    UInputMappingContext* Context = nullptr;
+    if (ContextSpec)
+    {
+        Context = ExistingContext ? ExistingContext : CreateInputAsset<UInputMappingContext>(PackagePath, ContextName);
+        if (!Context)
+        {
+            return Fail(FString::Printf(TEXT("Failed to create package %s"), *(PackagePath / ContextName)));
+        }
+        if (!ExistingContext)
+        {
+            CreatedAssets.Add(Context);
+        }
+    }
+
+    // Apply the validated spec
+    TArray<TSharedPtr<FJsonValue>> ActionResults;
+    for (const FInputActionSpec& Action : Actions)
+    {
+        UInputAction* ActionAsset = ActionsByName[Action.Name];
+        const bool bCreated = Action.Existing == nullptr;
+
+        TSharedPtr<FJsonObject> ActionResult = MakeShared<FJsonObject>();
+        ActionResult->SetStringField(TEXT("name"), Action.Name);
+        ActionResult->SetStringField(TEXT("path"), ActionAsset->GetPathName());
+        ActionResult->SetStringField(TEXT("status"), bCreated ? TEXT("created") : (bOverwrite ? TEXT("updated") : TEXT("existing")));
+        ActionResults.Add(MakeShared<FJsonValueObject>(ActionResult));
+
+        // Existing actions are left alone unless overwriting
+        if (!bCreated && !bOverwrite)
+        {
+            continue;
+        }
+        if (!bCreated)
+        {
+            ModifiedAssets.Add(ActionAsset);
+        }
+
+        ActionAsset->Modify();
+        ActionAsset->ValueType = Action.ValueType;
+        if (Action.Description.IsSet())
+        {
+            ActionAsset->ActionDescription = FText::FromString(Action.Description.GetValue());
+        }
+        if (Action.bConsumeInput.IsSet())
+        {
+            ActionAsset->bConsumeInput = Action.bConsumeInput.GetValue();
+        }
+        AdoptInputObjects(ActionAsset, Action.Triggers);
+        AdoptInputObjects(ActionAsset, Action.Modifiers);
+        if (Action.Triggers.IsSet())
+        {
+            ActionAsset->Triggers = Action.Triggers.GetValue();
+        }
+        if (Action.Modifiers.IsSet())
+        {
+            ActionAsset->Modifiers = Action.Modifiers.GetValue();
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    if (Context)
+    {
+        if (ExistingContext)
+        {
+            ModifiedAssets.Add(Context);
+        }
+        Context->Modify();
+        if (bOverwrite)
+        {
+            Context->UnmapAll();
+        }
+        if (bHasContextDescription)
+        {
+            Context->ContextDescription = FText::FromString(ContextDescription);
+        }
+
+        TArray<TSharedPtr<FJsonValue>> MappingResults;
+        int32 SkippedCount = 0;
+        for (const FInputMappingSpec& MappingSpec : Mappings)
+        {
+            UInputAction* Action = ActionsByName[MappingSpec.ActionName];
+            const bool bDuplicate = Context->GetMappings().ContainsByPredicate([Action, &MappingSpec](const FEnhancedActionKeyMapping& Existing)
+            {
+                return Existing.Action == Action && Existing.Key == MappingSpec.Key;
+            });
+            if (bDuplicate)
+            {
+                ++SkippedCount;
+                continue;
+            }
+
+            FEnhancedActionKeyMapping& Mapping = Context->MapKey(Action, MappingSpec.Key);
+            AdoptInputObjects(Context, MappingSpec.Triggers);
+            AdoptInputObjects(Context, MappingSpec.Modifiers);
+            if (MappingSpec.Triggers.IsSet())
+            {
+                Mapping.Triggers = MappingSpec.Triggers.GetValue();
+            }
+            if (MappingSpec.Modifiers.IsSet())
+            {
+                Mapping.Modifiers = MappingSpec.Modifiers.GetValue();
+            }
+
+            TSharedPtr<FJsonObject> MappingResult = MakeShared<FJsonObject>();
+            MappingResult->SetStringField(TEXT("action"), MappingSpec.ActionName);
+            MappingResult->SetStringField(TEXT("key"), MappingSpec.KeyName);
+            MappingResult->SetNumberField(TEXT("trigger_count"), Mapping.Triggers.Num());
+            MappingResult->SetNumberField(TEXT("modifier_count"), Mapping.Modifiers.Num());
+            MappingResults.Add(MakeShared<FJsonValueObject>(MappingResult));
+        }
+
+        TSharedPtr<FJsonObject> ContextResult = MakeShared<FJsonObject>();
+        ContextResult->SetStringField(TEXT("name"), ContextName);
+        ContextResult->SetStringField(TEXT("path"), Context->GetPathName());
+        ContextResult->SetStringField(TEXT("status"), ExistingContext ? TEXT("updated") : TEXT("created"));
+        ContextResult->SetArrayField(TEXT("mappings"), MappingResults);
+        ContextResult->SetNumberField(TEXT("skipped_duplicates"), SkippedCount);
+        ResultObj->SetObjectField(TEXT("mapping_context"), ContextResult);
+    }
+
+    // Announce the new assets together, then save the whole batch in one pass
+    for (UObject* Asset : CreatedAssets)
+    {
+        FAssetRegistryModule::AssetCreated(Asset);
+    }
+    for (UObject* Asset : CreatedAssets)
+    {
+        Asset->MarkPackageDirty();
+        FUnrealMCPCommonUtils::QueueAssetSave(Asset);
+    }
+    for (UObject* Asset : ModifiedAssets)
+    {
+        Asset->MarkPackageDirty();
+        FUnrealMCPCommonUtils::QueueAssetSave(Asset);
+    }
+
+    ResultObj->SetArrayField(TEXT("actions"), ActionResults);
+    ResultObj->SetNumberField(TEXT("created_count"), CreatedAssets.Num());
+    ResultObj->SetNumberField(TEXT("updated_count"), ModifiedAssets.Num());
+    return ResultObj;
+}
@@ -18,6 +18,15 @@
 #include "JsonObjectConverter.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Components/Button.h"
+#include "Components/ButtonSlot.h"
+#include "Components/BorderSlot.h"
+#include "Components/VerticalBoxSlot.h"
+#include "Components/HorizontalBoxSlot.h"
+#include "Components/GridSlot.h"
+#include "Components/UniformGridSlot.h"
+#include "Components/OverlaySlot.h"
+#include "Components/ScrollBoxSlot.h"
+#include "Components/SizeBoxSlot.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_VariableGet.h"
@@ -25,11 +34,240 @@
 #include "Kismet/GameplayStatics.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "K2Node_Event.h"
+#include "K2Node_ComponentBoundEvent.h"
+
+/** Widgets of one widget blueprint by name, and its widget event nodes by (widget, event) */
+struct FMCPWidgetBlueprintIndex
+{
+	bool bDirty = true;
+	FDelegateHandle CompiledHandle;
+	FDelegateHandle ChangedHandle;
+	TMap<FName, TWeakObjectPtr<UWidget>> WidgetsByName;
+	TMap<TPair<FName, FName>, TWeakObjectPtr<UK2Node_ComponentBoundEvent>> BoundEvents;
+
+	/** Cached get_widget_tree export, with every widget's object by name */
+	TSharedPtr<FJsonObject> TreeJson;
+	TMap<FName, TSharedPtr<FJsonObject>> WidgetJson;
+	TOptional<uint32> TreeSignature;
+};
 
 FUnrealMCPUMGCommands::FUnrealMCPUMGCommands()
 {
 }
 
+FUnrealMCPUMGCommands::~FUnrealMCPUMGCommands()
+{
+	for (const TPair<TWeakObjectPtr<UWidgetBlueprint>, TSharedPtr<FMCPWidgetBlueprintIndex>>& Entry : WidgetIndices)
+	{
+		if (UWidgetBlueprint* WidgetBlueprint = Entry.Key.Get())
+		{
+			WidgetBlueprint->OnCompiled().Remove(Entry.Value->CompiledHandle);
+			WidgetBlueprint->OnChanged().Remove(Entry.Value->ChangedHandle);
+		}
+	}
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+}
+
+UWidgetBlueprint* FUnrealMCPUMGCommands::FindWidgetBlueprint(const FString& BlueprintName, FString& OutErrorMessage)
+{
+	const bool bIsPath = BlueprintName.StartsWith(TEXT("/"));
+	if (const TWeakObjectPtr<UWidgetBlueprint>* Cached = WidgetBlueprintCache.Find(BlueprintName))
+	{
+		// Renamed or moved blueprints no longer answer to the name they were cached under
+		UWidgetBlueprint* WidgetBlueprint = Cached->Get();
+		if (WidgetBlueprint && (bIsPath ? WidgetBlueprint->GetPackage()->GetName() == FPackageName::ObjectPathToPackageName(BlueprintName)
+										: WidgetBlueprint->GetName() == BlueprintName))
+		{
+			return WidgetBlueprint;
+		}
+		WidgetBlueprintCache.Remove(BlueprintName);
+	}
+
+	// Resolve through the asset registry so a missing blueprint doesn't cost a failed load
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> Candidates;
+	if (bIsPath)
+	{
+		FString ObjectPath = BlueprintName;
+		if (!ObjectPath.Contains(TEXT(".")))
+		{
+			ObjectPath += TEXT(".") + FPackageName::GetShortName(ObjectPath);
+		}
+		const FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
+		if (Asset.IsValid())
+		{
+			Candidates.Add(Asset);
+		}
+	}
+	else
+	{
+		// The conventional location first, then a widget blueprint of that name anywhere
+		const FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(FString::Printf(TEXT("/Game/Widgets/%s.%s"), *BlueprintName, *BlueprintName)));
+		if (Asset.IsValid())
+		{
+			Candidates.Add(Asset);
+		}
+		else
+		{
+			FARFilter Filter;
+			Filter.ClassPaths.Add(UWidgetBlueprint::StaticClass()->GetClassPathName());
+			Filter.bRecursiveClasses = true;
+			AssetRegistry.GetAssets(Filter, Candidates);
+			Candidates.RemoveAll([&BlueprintName](const FAssetData& Candidate)
+			{
+				return Candidate.AssetName.ToString() != BlueprintName;
+			});
+		}
+	}
+
+	if (Candidates.Num() == 0)
+	{
+		OutErrorMessage = FUnrealMCPCommonUtils::WithNameSuggestions(FString::Printf(TEXT("Widget Blueprint '%s' not found"), *BlueprintName), BlueprintName, TEXT("WidgetBlueprint"));
+		return nullptr;
+	}
+	if (Candidates.Num() > 1)
+	{
+		TArray<FString> Paths;
+		for (const FAssetData& Candidate : Candidates)
+		{
+			Paths.Add(Candidate.PackageName.ToString());
+		}
+		OutErrorMessage = FString::Printf(TEXT("Widget Blueprint name '%s' is ambiguous, use one of: %s"), *BlueprintName, *FString::Join(Paths, TEXT(", ")));
+		return nullptr;
+	}
+
+	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Candidates[0].GetAsset());
+	if (!WidgetBlueprint)
+	{
+		OutErrorMessage = FString::Printf(TEXT("'%s' is not a Widget Blueprint"), *Candidates[0].PackageName.ToString());
+		return nullptr;
+	}
+
+	WidgetBlueprintCache.Add(BlueprintName, WidgetBlueprint);
+	return WidgetBlueprint;
+}
+
+TSharedPtr<FMCPWidgetBlueprintIndex> FUnrealMCPUMGCommands::GetWidgetIndex(UWidgetBlueprint* WidgetBlueprint, bool bForceRebuild)
+{
+	TSharedPtr<FMCPWidgetBlueprintIndex>* ExistingIndex = WidgetIndices.Find(WidgetBlueprint);
+	if (!ExistingIndex)
+	{
+		for (auto It = WidgetIndices.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		// Compiling (which every tree edit ends with) or changing the blueprint invalidates the index
+		TSharedPtr<FMCPWidgetBlueprintIndex> NewIndex = MakeShared<FMCPWidgetBlueprintIndex>();
+		TWeakPtr<FMCPWidgetBlueprintIndex> WeakIndex = NewIndex;
+		auto Invalidate = [WeakIndex](UBlueprint*)
+		{
+			if (TSharedPtr<FMCPWidgetBlueprintIndex> PinnedIndex = WeakIndex.Pin())
+			{
+				PinnedIndex->bDirty = true;
+			}
+		};
+		NewIndex->CompiledHandle = WidgetBlueprint->OnCompiled().AddLambda(Invalidate);
+		NewIndex->ChangedHandle = WidgetBlueprint->OnChanged().AddLambda(Invalidate);
+		ExistingIndex = &WidgetIndices.Add(WidgetBlueprint, NewIndex);
+
+		// Property edits on widgets and slots (text, visibility, layout) and binding changes don't compile the blueprint
+		if (!ObjectModifiedHandle.IsValid())
+		{
+			ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FUnrealMCPUMGCommands::InvalidateWidgetIndex);
+			ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([this](UObject* Object, FPropertyChangedEvent&)
+			{
+				InvalidateWidgetIndex(Object);
+			});
+		}
+	}
+
+	const TSharedPtr<FMCPWidgetBlueprintIndex> Index = *ExistingIndex;
+	if (Index->bDirty || bForceRebuild)
+	{
+		Index->WidgetsByName.Reset();
+		Index->BoundEvents.Reset();
+		Index->TreeJson.Reset();
+		Index->WidgetJson.Reset();
+		Index->TreeSignature.Reset();
+
+		if (WidgetBlueprint->WidgetTree)
+		{
+			WidgetBlueprint->WidgetTree->ForEachWidget([&Index](UWidget* Widget)
+			{
+				Index->WidgetsByName.Add(Widget->GetFName(), Widget);
+			});
+		}
+
+		for (UEdGraphNode* Node : FUnrealMCPCommonUtils::FindNodes(WidgetBlueprint, UK2Node_ComponentBoundEvent::StaticClass()->GetFName()))
+		{
+			UK2Node_ComponentBoundEvent* EventNode = CastChecked<UK2Node_ComponentBoundEvent>(Node);
+			Index->BoundEvents.Add(TPair<FName, FName>(EventNode->ComponentPropertyName, EventNode->DelegatePropertyName), EventNode);
+		}
+
+		Index->bDirty = false;
+	}
+	return Index;
+}
+
+void FUnrealMCPUMGCommands::InvalidateWidgetIndex(UObject* Object)
+{
+	if (!Object || WidgetIndices.Num() == 0)
+	{
+		return;
+	}
+
+	// Widgets, their slots and the widget tree are all outered to the blueprint; bindings live on the blueprint itself
+	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Object);
+	if (!WidgetBlueprint)
+	{
+		WidgetBlueprint = Object->GetTypedOuter<UWidgetBlueprint>();
+	}
+	if (const TSharedPtr<FMCPWidgetBlueprintIndex>* Index = WidgetBlueprint ? WidgetIndices.Find(WidgetBlueprint) : nullptr)
+	{
+		(*Index)->bDirty = true;
+	}
+}
+
+UWidget* FUnrealMCPUMGCommands::FindWidget(UWidgetBlueprint* WidgetBlueprint, const FName& WidgetName)
+{
+	// Edits made outside these commands don't always notify the blueprint, so a miss rebuilds the index once
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		const TSharedPtr<FMCPWidgetBlueprintIndex> Index = GetWidgetIndex(WidgetBlueprint, Attempt > 0);
+		if (const TWeakObjectPtr<UWidget>* Widget = Index->WidgetsByName.Find(WidgetName))
+		{
+			if (Widget->IsValid() && (*Widget)->GetFName() == WidgetName && (*Widget)->GetOuter() == WidgetBlueprint->WidgetTree)
+			{
+				return Widget->Get();
+			}
+		}
+	}
+	return nullptr;
+}
+
+UK2Node_ComponentBoundEvent* FUnrealMCPUMGCommands::FindBoundEvent(UWidgetBlueprint* WidgetBlueprint, const FName& WidgetName, const FName& EventName)
+{
+	const TPair<FName, FName> Key(WidgetName, EventName);
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		const TSharedPtr<FMCPWidgetBlueprintIndex> Index = GetWidgetIndex(WidgetBlueprint, Attempt > 0);
+		if (const TWeakObjectPtr<UK2Node_ComponentBoundEvent>* EventNode = Index->BoundEvents.Find(Key))
+		{
+			if (EventNode->IsValid() && (*EventNode)->GetGraph() && (*EventNode)->ComponentPropertyName == WidgetName && (*EventNode)->DelegatePropertyName == EventName)
+			{
+				return EventNode->Get();
+			}
+		}
+	}
+	return nullptr;
+}
+
 TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCommand(const FString& CommandName, const TSharedPtr<FJsonObject>& Params)
 {
 	if (CommandName == TEXT("create_umg_widget_blueprint"))
@@ -56,6 +294,14 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCommand(const FString& Comm
 	{
 		return HandleSetTextBlockBinding(Params);
 	}
+	else if (CommandName == TEXT("build_widget_tree"))
+	{
+		return HandleBuildWidgetTree(Params);
+	}
+	else if (CommandName == TEXT("get_widget_tree"))
+	{
+		return HandleGetWidgetTree(Params);
+	}
 
 	return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown UMG command: %s"), *CommandName));
 }
@@ -69,10 +315,14 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCreateUMGWidgetBlueprint(co
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
 	}
 
+	// Get optional parameters
+	FString PackagePath = TEXT("/Game/Widgets");
+	Params->TryGetStringField(TEXT("path"), PackagePath);
+	PackagePath.RemoveFromEnd(TEXT("/"));
+
 	// Create the full asset path
-	FString PackagePath = TEXT("/Game/Widgets/");
 	FString AssetName = BlueprintName;
-	FString FullPath = PackagePath + AssetName;
+	FString FullPath = PackagePath + TEXT("/") + AssetName;
 
 	// Check if asset already exists
 	if (UEditorAssetLibrary::DoesAssetExist(FullPath))
@@ -142,11 +392,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddTextBlockToWidget(const
 	}
 
 	// Find the Widget Blueprint
-	FString FullPath = TEXT("/Game/Widgets/") + BlueprintName;
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	FString ErrorMessage;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName, ErrorMessage);
 	if (!WidgetBlueprint)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget Blueprint '%s' not found"), *BlueprintName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
 	}
 
 	// Get optional parameters
@@ -205,11 +455,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddWidgetToViewport(const T
 	}
 
 	// Find the Widget Blueprint
-	FString FullPath = TEXT("/Game/Widgets/") + BlueprintName;
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	FString ErrorMessage;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName, ErrorMessage);
 	if (!WidgetBlueprint)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget Blueprint '%s' not found"), *BlueprintName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
 	}
 
 	// Get optional Z-order parameter
@@ -263,11 +513,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddButtonToWidget(const TSh
 	}
 
 	// Load the Widget Blueprint
-	const FString BlueprintPath = FString::Printf(TEXT("/Game/Widgets/%s.%s"), *BlueprintName, *BlueprintName);
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
+	FString ErrorMessage;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName, ErrorMessage);
 	if (!WidgetBlueprint)
 	{
-		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to load Widget Blueprint: %s"), *BlueprintPath));
+		Response->SetStringField(TEXT("error"), ErrorMessage);
 		return Response;
 	}
 
@@ -312,7 +562,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleAddButtonToWidget(const TSh
 
 	// Save the Widget Blueprint
 	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	FUnrealMCPCommonUtils::QueueAssetSave(WidgetBlueprint);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("widget_name"), WidgetName);
@@ -346,11 +596,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 	}
 
 	// Load the Widget Blueprint
-	const FString BlueprintPath = FString::Printf(TEXT("/Game/Widgets/%s.%s"), *BlueprintName, *BlueprintName);
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
+	FString ErrorMessage;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName, ErrorMessage);
 	if (!WidgetBlueprint)
 	{
-		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to load Widget Blueprint: %s"), *BlueprintPath));
+		Response->SetStringField(TEXT("error"), ErrorMessage);
 		return Response;
 	}
 
@@ -363,66 +613,41 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 	}
 
 	// Find the widget in the blueprint
-	UWidget* Widget = WidgetBlueprint->WidgetTree->FindWidget(*WidgetName);
+	UWidget* Widget = FindWidget(WidgetBlueprint, FName(*WidgetName));
 	if (!Widget)
 	{
 		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to find widget: %s"), *WidgetName));
 		return Response;
 	}
 
-	// Create the event node (e.g., OnClicked for buttons)
-	UK2Node_Event* EventNode = nullptr;
-	
-	// Find existing nodes first
-	TArray<UK2Node_Event*> AllEventNodes;
-	FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_Event>(WidgetBlueprint, AllEventNodes);
-	
-	for (UK2Node_Event* Node : AllEventNodes)
+	if (!FindFProperty<FMulticastDelegateProperty>(Widget->GetClass(), FName(*EventName)))
 	{
-		if (Node->CustomFunctionName == FName(*EventName) && Node->EventReference.GetMemberParentClass() == Widget->GetClass())
-		{
-			EventNode = Node;
-			break;
-		}
+		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("%s has no event %s"), *Widget->GetClass()->GetName(), *EventName));
+		return Response;
+	}
+
+	// Bound events hang off the widget's variable, so the widget has to be one
+	if (!Widget->bIsVariable)
+	{
+		Widget->bIsVariable = true;
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+	}
+	FObjectProperty* WidgetProperty = FindFProperty<FObjectProperty>(WidgetBlueprint->SkeletonGeneratedClass, Widget->GetFName());
+	if (!WidgetProperty)
+	{
+		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Widget %s has no variable in the generated class"), *WidgetName));
+		return Response;
 	}
 
-	// If no existing node, create a new one
+	// Reuse the existing event node (e.g. OnClicked for buttons), or create one in free space
+	UK2Node_ComponentBoundEvent* EventNode = FindBoundEvent(WidgetBlueprint, Widget->GetFName(), FName(*EventName));
 	if (!EventNode)
 	{
-		// Calculate position - place it below existing nodes
-		float MaxHeight = 0.0f;
-		for (UEdGraphNode* Node : EventGraph->Nodes)
-		{
-			MaxHeight = FMath::Max(MaxHeight, Node->NodePosY);
-		}
-		
-		const FVector2D NodePos(200, MaxHeight + 200);
-
-		// Call CreateNewBoundEventForClass, which returns void, so we can't capture the return value directly
-		// We'll need to find the node after creating it
-		FKismetEditorUtilities::CreateNewBoundEventForClass(
-			Widget->GetClass(),
-			FName(*EventName),
-			WidgetBlueprint,
-			nullptr  // We don't need a specific property binding
-		);
-
-		// Now find the newly created node
-		TArray<UK2Node_Event*> UpdatedEventNodes;
-		FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_Event>(WidgetBlueprint, UpdatedEventNodes);
-		
-		for (UK2Node_Event* Node : UpdatedEventNodes)
+		FKismetEditorUtilities::CreateNewBoundEventForComponent(Widget, FName(*EventName), WidgetBlueprint, WidgetProperty);
+		EventNode = FindBoundEvent(WidgetBlueprint, Widget->GetFName(), FName(*EventName));
+		if (EventNode)
 		{
-			if (Node->CustomFunctionName == FName(*EventName) && Node->EventReference.GetMemberParentClass() == Widget->GetClass())
-			{
-				EventNode = Node;
-				
-				// Set position of the node
-				EventNode->NodePosX = NodePos.X;
-				EventNode->NodePosY = NodePos.Y;
-				
-				break;
-			}
+			FUnrealMCPCommonUtils::AutoPlaceNode(EventNode);
 		}
 	}
 
@@ -434,7 +659,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBindWidgetEvent(const TShar
 
 	// Save the Widget Blueprint
 	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	FUnrealMCPCommonUtils::QueueAssetSave(WidgetBlueprint);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("event_name"), EventName);
@@ -468,11 +693,11 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 	}
 
 	// Load the Widget Blueprint
-	const FString BlueprintPath = FString::Printf(TEXT("/Game/Widgets/%s.%s"), *BlueprintName, *BlueprintName);
-	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(BlueprintPath));
+	FString ErrorMessage;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName, ErrorMessage);
 	if (!WidgetBlueprint)
 	{
-		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to load Widget Blueprint: %s"), *BlueprintPath));
+		Response->SetStringField(TEXT("error"), ErrorMessage);
 		return Response;
 	}
 
@@ -484,7 +709,7 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 	);
 
 	// Find the TextBlock widget
-	UTextBlock* TextBlock = Cast<UTextBlock>(WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName)));
+	UTextBlock* TextBlock = Cast<UTextBlock>(FindWidget(WidgetBlueprint, FName(*WidgetName)));
 	if (!TextBlock)
 	{
 		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to find TextBlock widget: %s"), *WidgetName));
@@ -536,9 +761,977 @@ TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleSetTextBlockBinding(const T
 
 	// Save the Widget Blueprint
 	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	FUnrealMCPCommonUtils::QueueAssetSave(WidgetBlueprint);
 
 	Response->SetBoolField(TEXT("success"), true);
 	Response->SetStringField(TEXT("binding_name"), BindingName);
 	return Response;
-} 
\ No newline at end of file
+}
+
+namespace
+{
+	/** Per-widget state gathered while building a tree, applied once the skeleton knows the new widgets */
+	struct FMCPBuiltWidget
+	{
+		UWidget* Widget = nullptr;
+		TSharedPtr<FJsonObject> Spec;
+	};
+
+	UClass* FindWidgetClass(const FString& TypeName)
+	{
+		UClass* WidgetClass = FindFirstObject<UClass>(*TypeName, EFindFirstObjectOptions::NativeFirst);
+		if (!WidgetClass && TypeName.Len() > 1 && TypeName[0] == TEXT('U'))
+		{
+			WidgetClass = FindFirstObject<UClass>(*TypeName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+		}
+		if (!WidgetClass || !WidgetClass->IsChildOf(UWidget::StaticClass()) || WidgetClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
+		{
+			return nullptr;
+		}
+		return WidgetClass;
+	}
+
+	bool GetJsonVector2D(const TSharedPtr<FJsonObject>& Object, const FString& FieldName, FVector2D& OutValue)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!Object->TryGetArrayField(FieldName, Values) || Values->Num() < 2)
+		{
+			return false;
+		}
+		OutValue = FVector2D((*Values)[0]->AsNumber(), (*Values)[1]->AsNumber());
+		return true;
+	}
+
+	/** A margin is either a single uniform number or [left, top, right, bottom] */
+	bool GetJsonMargin(const TSharedPtr<FJsonObject>& Object, const FString& FieldName, FMargin& OutMargin)
+	{
+		double Uniform = 0.0;
+		if (Object->TryGetNumberField(FieldName, Uniform))
+		{
+			OutMargin = FMargin(Uniform);
+			return true;
+		}
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!Object->TryGetArrayField(FieldName, Values) || Values->Num() < 4)
+		{
+			return false;
+		}
+		OutMargin = FMargin((*Values)[0]->AsNumber(), (*Values)[1]->AsNumber(), (*Values)[2]->AsNumber(), (*Values)[3]->AsNumber());
+		return true;
+	}
+
+	bool GetJsonColor(const TSharedPtr<FJsonObject>& Object, const FString& FieldName, FLinearColor& OutColor)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!Object->TryGetArrayField(FieldName, Values) || Values->Num() < 3)
+		{
+			return false;
+		}
+		OutColor = FLinearColor((*Values)[0]->AsNumber(), (*Values)[1]->AsNumber(), (*Values)[2]->AsNumber(),
+			Values->Num() > 3 ? (*Values)[3]->AsNumber() : 1.0);
+		return true;
+	}
+
+	/** Slot settings shared by the box, overlay, grid, border, button, scroll box and size box slots */
+	struct FMCPSlotAlignment
+	{
+		TOptional<FMargin> Padding;
+		TOptional<EHorizontalAlignment> HorizontalAlignment;
+		TOptional<EVerticalAlignment> VerticalAlignment;
+
+		explicit FMCPSlotAlignment(const TSharedPtr<FJsonObject>& SlotSpec)
+		{
+			FMargin Margin;
+			if (GetJsonMargin(SlotSpec, TEXT("padding"), Margin))
+			{
+				Padding = Margin;
+			}
+
+			static const TMap<FString, EHorizontalAlignment> HorizontalAlignments = {
+				{ TEXT("fill"), HAlign_Fill }, { TEXT("left"), HAlign_Left }, { TEXT("center"), HAlign_Center }, { TEXT("right"), HAlign_Right } };
+			static const TMap<FString, EVerticalAlignment> VerticalAlignments = {
+				{ TEXT("fill"), VAlign_Fill }, { TEXT("top"), VAlign_Top }, { TEXT("center"), VAlign_Center }, { TEXT("bottom"), VAlign_Bottom } };
+
+			FString AlignmentName;
+			if (SlotSpec->TryGetStringField(TEXT("h_align"), AlignmentName) && HorizontalAlignments.Contains(AlignmentName.ToLower()))
+			{
+				HorizontalAlignment = HorizontalAlignments[AlignmentName.ToLower()];
+			}
+			if (SlotSpec->TryGetStringField(TEXT("v_align"), AlignmentName) && VerticalAlignments.Contains(AlignmentName.ToLower()))
+			{
+				VerticalAlignment = VerticalAlignments[AlignmentName.ToLower()];
+			}
+		}
+
+		template <typename TSlot>
+		void ApplyAlignment(TSlot* Slot) const
+		{
+			if (HorizontalAlignment.IsSet())
+			{
+				Slot->SetHorizontalAlignment(HorizontalAlignment.GetValue());
+			}
+			if (VerticalAlignment.IsSet())
+			{
+				Slot->SetVerticalAlignment(VerticalAlignment.GetValue());
+			}
+		}
+
+		template <typename TSlot>
+		void Apply(TSlot* Slot) const
+		{
+			if (Padding.IsSet())
+			{
+				Slot->SetPadding(Padding.GetValue());
+			}
+			ApplyAlignment(Slot);
+		}
+	};
+
+	/** "auto" or "fill", with "fill" also taking a number as the fill ratio */
+	void ApplyBoxSlotSize(const TSharedPtr<FJsonObject>& SlotSpec, TFunctionRef<void(const FSlateChildSize&)> SetSize)
+	{
+		FString SizeRule;
+		double FillRatio = 1.0;
+		const bool bFillRatio = SlotSpec->TryGetNumberField(TEXT("fill"), FillRatio);
+		if (!SlotSpec->TryGetStringField(TEXT("size_rule"), SizeRule) && !bFillRatio)
+		{
+			return;
+		}
+
+		FSlateChildSize Size(SizeRule.Equals(TEXT("auto"), ESearchCase::IgnoreCase) ? ESlateSizeRule::Automatic : ESlateSizeRule::Fill);
+		Size.Value = FillRatio;
+		SetSize(Size);
+	}
+
+	void ApplySlotSpec(UPanelSlot* Slot, const TSharedPtr<FJsonObject>& SlotSpec)
+	{
+		if (!Slot || !SlotSpec.IsValid())
+		{
+			return;
+		}
+
+		const FMCPSlotAlignment Alignment(SlotSpec);
+		FVector2D Vector;
+		int32 IntValue = 0;
+
+		if (UCanvasPanelSlot* CanvasSlot = Cast<UCanvasPanelSlot>(Slot))
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Anchors = nullptr;
+			if (SlotSpec->TryGetArrayField(TEXT("anchors"), Anchors) && Anchors->Num() >= 2)
+			{
+				const double MinX = (*Anchors)[0]->AsNumber();
+				const double MinY = (*Anchors)[1]->AsNumber();
+				CanvasSlot->SetAnchors(Anchors->Num() >= 4
+					? FAnchors(MinX, MinY, (*Anchors)[2]->AsNumber(), (*Anchors)[3]->AsNumber())
+					: FAnchors(MinX, MinY));
+			}
+			FMargin Offsets;
+			if (GetJsonMargin(SlotSpec, TEXT("offsets"), Offsets))
+			{
+				CanvasSlot->SetOffsets(Offsets);
+			}
+			if (GetJsonVector2D(SlotSpec, TEXT("position"), Vector))
+			{
+				CanvasSlot->SetPosition(Vector);
+			}
+			if (GetJsonVector2D(SlotSpec, TEXT("size"), Vector))
+			{
+				CanvasSlot->SetSize(Vector);
+			}
+			if (GetJsonVector2D(SlotSpec, TEXT("alignment"), Vector))
+			{
+				CanvasSlot->SetAlignment(Vector);
+			}
+			bool bAutoSize = false;
+			if (SlotSpec->TryGetBoolField(TEXT("auto_size"), bAutoSize))
+			{
+				CanvasSlot->SetAutoSize(bAutoSize);
+			}
+			if (SlotSpec->TryGetNumberField(TEXT("z_order"), IntValue))
+			{
+				CanvasSlot->SetZOrder(IntValue);
+			}
+		}
+		else if (UVerticalBoxSlot* VerticalSlot = Cast<UVerticalBoxSlot>(Slot))
+		{
+			Alignment.Apply(VerticalSlot);
+			ApplyBoxSlotSize(SlotSpec, [VerticalSlot](const FSlateChildSize& Size) { VerticalSlot->SetSize(Size); });
+		}
+		else if (UHorizontalBoxSlot* HorizontalSlot = Cast<UHorizontalBoxSlot>(Slot))
+		{
+			Alignment.Apply(HorizontalSlot);
+			ApplyBoxSlotSize(SlotSpec, [HorizontalSlot](const FSlateChildSize& Size) { HorizontalSlot->SetSize(Size); });
+		}
+		else if (UGridSlot* GridSlot = Cast<UGridSlot>(Slot))
+		{
+			Alignment.Apply(GridSlot);
+			if (SlotSpec->TryGetNumberField(TEXT("row"), IntValue))
+			{
+				GridSlot->SetRow(IntValue);
+			}
+			if (SlotSpec->TryGetNumberField(TEXT("column"), IntValue))
+			{
+				GridSlot->SetColumn(IntValue);
+			}
+			if (SlotSpec->TryGetNumberField(TEXT("row_span"), IntValue))
+			{
+				GridSlot->SetRowSpan(IntValue);
+			}
+			if (SlotSpec->TryGetNumberField(TEXT("column_span"), IntValue))
+			{
+				GridSlot->SetColumnSpan(IntValue);
+			}
+		}
+		else if (UUniformGridSlot* UniformGridSlot = Cast<UUniformGridSlot>(Slot))
+		{
+			Alignment.ApplyAlignment(UniformGridSlot);
+			if (SlotSpec->TryGetNumberField(TEXT("row"), IntValue))
+			{
+				UniformGridSlot->SetRow(IntValue);
+			}
+			if (SlotSpec->TryGetNumberField(TEXT("column"), IntValue))
+			{
+				UniformGridSlot->SetColumn(IntValue);
+			}
+		}
+		else if (UOverlaySlot* OverlaySlot = Cast<UOverlaySlot>(Slot))
+		{
+			Alignment.Apply(OverlaySlot);
+		}
+		else if (UBorderSlot* BorderSlot = Cast<UBorderSlot>(Slot))
+		{
+			Alignment.Apply(BorderSlot);
+		}
+		else if (UButtonSlot* ButtonSlot = Cast<UButtonSlot>(Slot))
+		{
+			Alignment.Apply(ButtonSlot);
+		}
+		else if (UScrollBoxSlot* ScrollBoxSlot = Cast<UScrollBoxSlot>(Slot))
+		{
+			Alignment.Apply(ScrollBoxSlot);
+		}
+		else if (USizeBoxSlot* SizeBoxSlot = Cast<USizeBoxSlot>(Slot))
+		{
+			Alignment.Apply(SizeBoxSlot);
+		}
+	}
+
+	/** Check a whole spec before anything is constructed, so a bad node leaves the widget tree untouched */
+	bool ValidateWidgetSpec(const TSharedPtr<FJsonObject>& Spec, TSet<FString>& Names, FString& OutError)
+	{
+		FString TypeName;
+		if (!Spec->TryGetStringField(TEXT("type"), TypeName))
+		{
+			OutError = TEXT("Every widget needs a 'type'");
+			return false;
+		}
+
+		UClass* WidgetClass = FindWidgetClass(TypeName);
+		if (!WidgetClass)
+		{
+			OutError = FUnrealMCPCommonUtils::WithNameSuggestions(FString::Printf(TEXT("Unknown widget type: %s"), *TypeName), TypeName, TEXT("class"));
+			return false;
+		}
+
+		FString Name;
+		if (Spec->TryGetStringField(TEXT("name"), Name))
+		{
+			if (Names.Contains(Name))
+			{
+				OutError = FString::Printf(TEXT("Duplicate widget name: %s"), *Name);
+				return false;
+			}
+			Names.Add(Name);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+		if (Spec->TryGetArrayField(TEXT("children"), Children) && Children->Num() > 0)
+		{
+			if (!WidgetClass->IsChildOf(UPanelWidget::StaticClass()))
+			{
+				OutError = FString::Printf(TEXT("%s is not a panel and can't have children"), *TypeName);
+				return false;
+			}
+			if (Children->Num() > 1 && !WidgetClass->GetDefaultObject<UPanelWidget>()->CanHaveMultipleChildren())
+			{
+				OutError = FString::Printf(TEXT("%s can only have one child"), *TypeName);
+				return false;
+			}
+			if (WidgetClass->IsChildOf(UButton::StaticClass()) && Spec->HasField(TEXT("text")))
+			{
+				OutError = FString::Printf(TEXT("Button %s has both 'text' and 'children'"), *Name);
+				return false;
+			}
+			for (const TSharedPtr<FJsonValue>& Child : *Children)
+			{
+				const TSharedPtr<FJsonObject>* ChildSpec = nullptr;
+				if (!Child->TryGetObject(ChildSpec))
+				{
+					OutError = TEXT("Widget children must be objects");
+					return false;
+				}
+				if (!ValidateWidgetSpec(*ChildSpec, Names, OutError))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	void ApplyTextSpec(UTextBlock* TextBlock, const TSharedPtr<FJsonObject>& Spec)
+	{
+		FString Text;
+		if (Spec->TryGetStringField(TEXT("text"), Text))
+		{
+			TextBlock->SetText(FText::FromString(Text));
+		}
+		int32 FontSize = 0;
+		if (Spec->TryGetNumberField(TEXT("font_size"), FontSize))
+		{
+			FSlateFontInfo Font = TextBlock->GetFont();
+			Font.Size = FontSize;
+			TextBlock->SetFont(Font);
+		}
+		FLinearColor Color;
+		if (GetJsonColor(Spec, TEXT("color"), Color))
+		{
+			TextBlock->SetColorAndOpacity(FSlateColor(Color));
+		}
+	}
+
+	/** Pick a name for a widget the spec doesn't name, avoiding the tree and every name the spec has yet to construct */
+	FName MakeGeneratedWidgetName(UWidgetTree* WidgetTree, UClass* WidgetClass, const FString& BaseName, const TSet<FString>& ReservedNames)
+	{
+		FName WidgetName = BaseName.IsEmpty() ? MakeUniqueObjectName(WidgetTree, WidgetClass) : FName(*BaseName);
+		int32 Suffix = 1;
+		while (ReservedNames.Contains(WidgetName.ToString()) || StaticFindObjectFast(nullptr, WidgetTree, WidgetName))
+		{
+			WidgetName = BaseName.IsEmpty() ? MakeUniqueObjectName(WidgetTree, WidgetClass) : FName(*FString::Printf(TEXT("%s_%d"), *BaseName, Suffix++));
+		}
+		return WidgetName;
+	}
+
+	/** Construct a widget and its children in the tree. The spec has been validated, so only property errors are reported. */
+	UWidget* BuildWidget(UWidgetBlueprint* WidgetBlueprint, const TSharedPtr<FJsonObject>& Spec, const FString& ParentName, const TSet<FString>& ReservedNames,
+		TArray<FMCPBuiltWidget>& OutBuilt, TArray<TSharedPtr<FJsonValue>>& OutWidgets, TArray<TSharedPtr<FJsonValue>>& OutErrors)
+	{
+		UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+		UClass* WidgetClass = FindWidgetClass(Spec->GetStringField(TEXT("type")));
+
+		FString Name;
+		Spec->TryGetStringField(TEXT("name"), Name);
+		const FName WidgetName = Name.IsEmpty() ? MakeGeneratedWidgetName(WidgetTree, WidgetClass, FString(), ReservedNames) : FName(*Name);
+		UWidget* Widget = WidgetTree->ConstructWidget<UWidget>(WidgetClass, WidgetName);
+
+		// Widgets with events or bindings must be variables so the generated class has a property to bind to
+		bool bIsVariable = Spec->HasField(TEXT("events")) || Spec->HasField(TEXT("bindings"));
+		Spec->TryGetBoolField(TEXT("is_variable"), bIsVariable);
+		Widget->bIsVariable = bIsVariable;
+
+		if (UTextBlock* TextBlock = Cast<UTextBlock>(Widget))
+		{
+			ApplyTextSpec(TextBlock, Spec);
+		}
+		else if (UButton* Button = Cast<UButton>(Widget))
+		{
+			if (Spec->HasField(TEXT("text")))
+			{
+				const FName LabelName = MakeGeneratedWidgetName(WidgetTree, UTextBlock::StaticClass(), Widget->GetName() + TEXT("_Text"), ReservedNames);
+				UTextBlock* ButtonText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), LabelName);
+				ApplyTextSpec(ButtonText, Spec);
+				Button->AddChild(ButtonText);
+				WidgetBlueprint->OnVariableAdded(ButtonText->GetFName());
+			}
+			FLinearColor BackgroundColor;
+			if (GetJsonColor(Spec, TEXT("background_color"), BackgroundColor))
+			{
+				Button->SetBackgroundColor(BackgroundColor);
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* Properties = nullptr;
+		if (Spec->TryGetObjectField(TEXT("properties"), Properties))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values)
+			{
+				FString ErrorMessage;
+				if (!FUnrealMCPCommonUtils::SetObjectProperty(Widget, Property.Key, Property.Value, ErrorMessage))
+				{
+					OutErrors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s.%s: %s"), *Widget->GetName(), *Property.Key, *ErrorMessage)));
+				}
+			}
+		}
+
+		WidgetBlueprint->OnVariableAdded(Widget->GetFName());
+		OutBuilt.Add({ Widget, Spec });
+
+		TSharedPtr<FJsonObject> WidgetInfo = MakeShared<FJsonObject>();
+		WidgetInfo->SetStringField(TEXT("name"), Widget->GetName());
+		WidgetInfo->SetStringField(TEXT("type"), WidgetClass->GetName());
+		WidgetInfo->SetStringField(TEXT("parent"), ParentName);
+		OutWidgets.Add(MakeShared<FJsonValueObject>(WidgetInfo));
+
+		const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+		if (Spec->TryGetArrayField(TEXT("children"), Children))
+		{
+			UPanelWidget* Panel = CastChecked<UPanelWidget>(Widget);
+			for (const TSharedPtr<FJsonValue>& Child : *Children)
+			{
+				const TSharedPtr<FJsonObject>& ChildSpec = Child->AsObject();
+				UWidget* ChildWidget = BuildWidget(WidgetBlueprint, ChildSpec, Widget->GetName(), ReservedNames, OutBuilt, OutWidgets, OutErrors);
+				const TSharedPtr<FJsonObject>* SlotSpec = nullptr;
+				UPanelSlot* Slot = Panel->AddChild(ChildWidget);
+				if (ChildSpec->TryGetObjectField(TEXT("slot"), SlotSpec))
+				{
+					ApplySlotSpec(Slot, *SlotSpec);
+				}
+			}
+		}
+		return Widget;
+	}
+
+	/** Remove every widget from the tree, renaming them out of the way so their names can be reused */
+	void ClearWidgetTree(UWidgetBlueprint* WidgetBlueprint)
+	{
+		UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+		TArray<UWidget*> ExistingWidgets;
+		WidgetTree->GetAllWidgets(ExistingWidgets);
+
+		WidgetTree->RootWidget = nullptr;
+		for (UWidget* Widget : ExistingWidgets)
+		{
+			const FName OldName = Widget->GetFName();
+			Widget->RemoveFromParent();
+			Widget->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+			Widget->MarkAsGarbage();
+			WidgetBlueprint->OnVariableRemoved(OldName);
+		}
+	}
+
+	/** Drop bound events and property bindings whose widget is no longer in the tree, reporting what was removed */
+	void RemoveOrphanedWidgetReferences(UWidgetBlueprint* WidgetBlueprint, TArray<TSharedPtr<FJsonValue>>& OutRemovedEvents, TArray<TSharedPtr<FJsonValue>>& OutRemovedBindings)
+	{
+		TSet<FName> WidgetNames;
+		WidgetBlueprint->WidgetTree->ForEachWidget([&WidgetNames](UWidget* Widget)
+		{
+			WidgetNames.Add(Widget->GetFName());
+		});
+
+		for (UEdGraphNode* Node : FUnrealMCPCommonUtils::FindNodes(WidgetBlueprint, UK2Node_ComponentBoundEvent::StaticClass()->GetFName()))
+		{
+			UK2Node_ComponentBoundEvent* EventNode = CastChecked<UK2Node_ComponentBoundEvent>(Node);
+			if (!WidgetNames.Contains(EventNode->ComponentPropertyName))
+			{
+				TSharedPtr<FJsonObject> EventInfo = MakeShared<FJsonObject>();
+				EventInfo->SetStringField(TEXT("widget"), EventNode->ComponentPropertyName.ToString());
+				EventInfo->SetStringField(TEXT("event"), EventNode->DelegatePropertyName.ToString());
+				EventInfo->SetStringField(TEXT("node_id"), EventNode->NodeGuid.ToString());
+				OutRemovedEvents.Add(MakeShared<FJsonValueObject>(EventInfo));
+				FBlueprintEditorUtils::RemoveNode(WidgetBlueprint, EventNode, true);
+			}
+		}
+
+		WidgetBlueprint->Bindings.RemoveAll([&WidgetNames, &OutRemovedBindings](const FDelegateEditorBinding& Binding)
+		{
+			if (WidgetNames.Contains(FName(*Binding.ObjectName)))
+			{
+				return false;
+			}
+			OutRemovedBindings.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s.%s"), *Binding.ObjectName, *Binding.PropertyName.ToString())));
+			return true;
+		});
+	}
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleBuildWidgetTree(const TSharedPtr<FJsonObject>& Params)
+{
+	// Get required parameters
+	FString BlueprintName;
+	if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+	}
+
+	const TSharedPtr<FJsonObject>* RootSpec = nullptr;
+	if (!Params->TryGetObjectField(TEXT("root"), RootSpec))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'root' parameter"));
+	}
+
+	// Get optional parameters
+	bool bReplace = false;
+	Params->TryGetBoolField(TEXT("replace"), bReplace);
+
+	FString ParentName;
+	Params->TryGetStringField(TEXT("parent"), ParentName);
+
+	// Load the Widget Blueprint
+	FString ErrorMessage;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName, ErrorMessage);
+	if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(WidgetBlueprint ? FString::Printf(TEXT("%s has no widget tree"), *BlueprintName) : ErrorMessage);
+	}
+	UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
+
+	// Resolve where the new subtree goes before touching anything
+	UPanelWidget* ParentPanel = nullptr;
+	if (!bReplace && WidgetTree->RootWidget)
+	{
+		UWidget* ParentWidget = ParentName.IsEmpty() ? WidgetTree->RootWidget : FindWidget(WidgetBlueprint, FName(*ParentName));
+		ParentPanel = Cast<UPanelWidget>(ParentWidget);
+		if (!ParentPanel)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent widget is not a panel: %s"),
+				ParentWidget ? *ParentWidget->GetName() : *ParentName));
+		}
+		if (!ParentPanel->CanAddMoreChildren())
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent widget %s can't take another child"), *ParentPanel->GetName()));
+		}
+	}
+
+	// Names already in the tree come from a freshly built index, since the spec may name many widgets
+	TSet<FString> Names;
+	if (!bReplace)
+	{
+		for (const TPair<FName, TWeakObjectPtr<UWidget>>& Existing : GetWidgetIndex(WidgetBlueprint, true)->WidgetsByName)
+		{
+			Names.Add(Existing.Key.ToString());
+		}
+	}
+	if (!ValidateWidgetSpec(*RootSpec, Names, ErrorMessage))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+	}
+
+	// Build the whole tree in memory
+	WidgetBlueprint->Modify();
+	WidgetTree->Modify();
+	if (bReplace)
+	{
+		ClearWidgetTree(WidgetBlueprint);
+	}
+
+	TArray<FMCPBuiltWidget> Built;
+	TArray<TSharedPtr<FJsonValue>> Widgets;
+	TArray<TSharedPtr<FJsonValue>> Errors;
+	UWidget* Root = BuildWidget(WidgetBlueprint, *RootSpec, ParentPanel ? ParentPanel->GetName() : FString(), Names, Built, Widgets, Errors);
+	if (ParentPanel)
+	{
+		UPanelSlot* Slot = ParentPanel->AddChild(Root);
+		const TSharedPtr<FJsonObject>* SlotSpec = nullptr;
+		if ((*RootSpec)->TryGetObjectField(TEXT("slot"), SlotSpec))
+		{
+			ApplySlotSpec(Slot, *SlotSpec);
+		}
+	}
+	else
+	{
+		WidgetTree->RootWidget = Root;
+	}
+
+	// Widgets that didn't survive a replace take their event nodes and bindings with them
+	TArray<TSharedPtr<FJsonValue>> RemovedEvents;
+	TArray<TSharedPtr<FJsonValue>> RemovedBindings;
+	if (bReplace)
+	{
+		RemoveOrphanedWidgetReferences(WidgetBlueprint, RemovedEvents, RemovedBindings);
+	}
+
+	// Regenerate the skeleton once so event and property bindings can see the new widget variables
+	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+
+	int32 EventCount = 0;
+	for (const FMCPBuiltWidget& Entry : Built)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Events = nullptr;
+		if (Entry.Spec->TryGetArrayField(TEXT("events"), Events))
+		{
+			FObjectProperty* WidgetProperty = FindFProperty<FObjectProperty>(WidgetBlueprint->SkeletonGeneratedClass, Entry.Widget->GetFName());
+			for (const TSharedPtr<FJsonValue>& EventValue : *Events)
+			{
+				const FName EventName(*EventValue->AsString());
+				if (!WidgetProperty || !FindFProperty<FMulticastDelegateProperty>(Entry.Widget->GetClass(), EventName))
+				{
+					Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s has no event %s"), *Entry.Widget->GetName(), *EventName.ToString())));
+					continue;
+				}
+				if (!FindBoundEvent(WidgetBlueprint, WidgetProperty->GetFName(), EventName))
+				{
+					FKismetEditorUtilities::CreateNewBoundEventForComponent(Entry.Widget, EventName, WidgetBlueprint, WidgetProperty);
+					if (UK2Node_ComponentBoundEvent* EventNode = FindBoundEvent(WidgetBlueprint, WidgetProperty->GetFName(), EventName))
+					{
+						FUnrealMCPCommonUtils::AutoPlaceNode(EventNode);
+					}
+				}
+				++EventCount;
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* Bindings = nullptr;
+		if (Entry.Spec->TryGetObjectField(TEXT("bindings"), Bindings))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Binding : (*Bindings)->Values)
+			{
+				// Bind a widget property (e.g. "Text") to a function graph of the widget blueprint
+				const FString FunctionName = Binding.Value->AsString();
+				UEdGraph* const* FunctionGraph = WidgetBlueprint->FunctionGraphs.FindByPredicate([&FunctionName](const UEdGraph* Graph)
+				{
+					return Graph && Graph->GetName() == FunctionName;
+				});
+				if (!FunctionGraph)
+				{
+					Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s.%s: function %s not found"), *Entry.Widget->GetName(), *Binding.Key, *FunctionName)));
+					continue;
+				}
+
+				FDelegateEditorBinding EditorBinding;
+				EditorBinding.ObjectName = Entry.Widget->GetName();
+				EditorBinding.PropertyName = FName(*Binding.Key);
+				EditorBinding.FunctionName = FName(*FunctionName);
+				EditorBinding.MemberGuid = (*FunctionGraph)->GraphGuid;
+				EditorBinding.Kind = EBindingKind::Function;
+				WidgetBlueprint->Bindings.Add(EditorBinding);
+			}
+		}
+	}
+
+	// Compile and save once for the whole tree
+	TSharedPtr<FJsonObject> CompileResult = FUnrealMCPCommonUtils::CompileBlueprint(WidgetBlueprint, true);
+	FUnrealMCPCommonUtils::QueueAssetSave(WidgetBlueprint);
+
+	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("blueprint_name"), BlueprintName);
+	Response->SetStringField(TEXT("root"), Root->GetName());
+	Response->SetNumberField(TEXT("widget_count"), Widgets.Num());
+	Response->SetArrayField(TEXT("widgets"), Widgets);
+	Response->SetNumberField(TEXT("event_count"), EventCount);
+	if (bReplace)
+	{
+		Response->SetArrayField(TEXT("removed_events"), RemovedEvents);
+		Response->SetArrayField(TEXT("removed_bindings"), RemovedBindings);
+	}
+	Response->SetArrayField(TEXT("errors"), Errors);
+	Response->SetObjectField(TEXT("compile"), CompileResult);
+	return Response;
+}
+
+namespace
+{
+	TSharedPtr<FJsonValue> MakeJsonNumbers(std::initializer_list<double> Numbers)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (double Number : Numbers)
+		{
+			Values.Add(MakeShared<FJsonValueNumber>(Number));
+		}
+		return MakeShared<FJsonValueArray>(Values);
+	}
+
+	TSharedPtr<FJsonValue> MarginToJson(const FMargin& Margin)
+	{
+		return MakeJsonNumbers({ Margin.Left, Margin.Top, Margin.Right, Margin.Bottom });
+	}
+
+	/** Slot settings in the same form build_widget_tree takes them, so an export can be fed back in */
+	template <typename TSlot>
+	void AlignmentToJson(const TSlot* Slot, const TSharedPtr<FJsonObject>& SlotJson)
+	{
+		static const TCHAR* HorizontalNames[] = { TEXT("fill"), TEXT("left"), TEXT("center"), TEXT("right") };
+		static const TCHAR* VerticalNames[] = { TEXT("fill"), TEXT("top"), TEXT("center"), TEXT("bottom") };
+		SlotJson->SetStringField(TEXT("h_align"), HorizontalNames[FMath::Clamp<int32>(Slot->GetHorizontalAlignment(), 0, 3)]);
+		SlotJson->SetStringField(TEXT("v_align"), VerticalNames[FMath::Clamp<int32>(Slot->GetVerticalAlignment(), 0, 3)]);
+	}
+
+	template <typename TSlot>
+	void PaddedSlotToJson(const TSlot* Slot, const TSharedPtr<FJsonObject>& SlotJson)
+	{
+		SlotJson->SetField(TEXT("padding"), MarginToJson(Slot->GetPadding()));
+		AlignmentToJson(Slot, SlotJson);
+	}
+
+	void BoxSlotSizeToJson(const FSlateChildSize& Size, const TSharedPtr<FJsonObject>& SlotJson)
+	{
+		SlotJson->SetStringField(TEXT("size_rule"), Size.SizeRule == ESlateSizeRule::Automatic ? TEXT("auto") : TEXT("fill"));
+		if (Size.SizeRule == ESlateSizeRule::Fill)
+		{
+			SlotJson->SetNumberField(TEXT("fill"), Size.Value);
+		}
+	}
+
+	TSharedPtr<FJsonObject> SlotToJson(const UPanelSlot* Slot)
+	{
+		TSharedPtr<FJsonObject> SlotJson = MakeShared<FJsonObject>();
+		SlotJson->SetStringField(TEXT("type"), Slot->GetClass()->GetName());
+
+		if (const UCanvasPanelSlot* CanvasSlot = Cast<UCanvasPanelSlot>(Slot))
+		{
+			const FAnchors Anchors = CanvasSlot->GetAnchors();
+			SlotJson->SetField(TEXT("anchors"), MakeJsonNumbers({ Anchors.Minimum.X, Anchors.Minimum.Y, Anchors.Maximum.X, Anchors.Maximum.Y }));
+			SlotJson->SetField(TEXT("position"), MakeJsonNumbers({ CanvasSlot->GetPosition().X, CanvasSlot->GetPosition().Y }));
+			SlotJson->SetField(TEXT("size"), MakeJsonNumbers({ CanvasSlot->GetSize().X, CanvasSlot->GetSize().Y }));
+			SlotJson->SetField(TEXT("alignment"), MakeJsonNumbers({ CanvasSlot->GetAlignment().X, CanvasSlot->GetAlignment().Y }));
+			SlotJson->SetBoolField(TEXT("auto_size"), CanvasSlot->GetAutoSize());
+			SlotJson->SetNumberField(TEXT("z_order"), CanvasSlot->GetZOrder());
+		}
+		else if (const UVerticalBoxSlot* VerticalSlot = Cast<UVerticalBoxSlot>(Slot))
+		{
+			PaddedSlotToJson(VerticalSlot, SlotJson);
+			BoxSlotSizeToJson(VerticalSlot->GetSize(), SlotJson);
+		}
+		else if (const UHorizontalBoxSlot* HorizontalSlot = Cast<UHorizontalBoxSlot>(Slot))
+		{
+			PaddedSlotToJson(HorizontalSlot, SlotJson);
+			BoxSlotSizeToJson(HorizontalSlot->GetSize(), SlotJson);
+		}
+		else if (const UGridSlot* GridSlot = Cast<UGridSlot>(Slot))
+		{
+			PaddedSlotToJson(GridSlot, SlotJson);
+			SlotJson->SetNumberField(TEXT("row"), GridSlot->GetRow());
+			SlotJson->SetNumberField(TEXT("column"), GridSlot->GetColumn());
+			SlotJson->SetNumberField(TEXT("row_span"), GridSlot->GetRowSpan());
+			SlotJson->SetNumberField(TEXT("column_span"), GridSlot->GetColumnSpan());
+		}
+		else if (const UUniformGridSlot* UniformGridSlot = Cast<UUniformGridSlot>(Slot))
+		{
+			AlignmentToJson(UniformGridSlot, SlotJson);
+			SlotJson->SetNumberField(TEXT("row"), UniformGridSlot->GetRow());
+			SlotJson->SetNumberField(TEXT("column"), UniformGridSlot->GetColumn());
+		}
+		else if (const UOverlaySlot* OverlaySlot = Cast<UOverlaySlot>(Slot))
+		{
+			PaddedSlotToJson(OverlaySlot, SlotJson);
+		}
+		else if (const UBorderSlot* BorderSlot = Cast<UBorderSlot>(Slot))
+		{
+			PaddedSlotToJson(BorderSlot, SlotJson);
+		}
+		else if (const UButtonSlot* ButtonSlot = Cast<UButtonSlot>(Slot))
+		{
+			PaddedSlotToJson(ButtonSlot, SlotJson);
+		}
+		else if (const UScrollBoxSlot* ScrollBoxSlot = Cast<UScrollBoxSlot>(Slot))
+		{
+			PaddedSlotToJson(ScrollBoxSlot, SlotJson);
+		}
+		else if (const USizeBoxSlot* SizeBoxSlot = Cast<USizeBoxSlot>(Slot))
+		{
+			PaddedSlotToJson(SizeBoxSlot, SlotJson);
+		}
+		return SlotJson;
+	}
+
+	/** Widget names, classes and parents; a different signature means widgets were added, removed, renamed or moved */
+	uint32 GetWidgetTreeSignature(const UWidgetBlueprint* WidgetBlueprint)
+	{
+		uint32 Signature = 0;
+		if (WidgetBlueprint->WidgetTree)
+		{
+			Signature = GetTypeHash(WidgetBlueprint->WidgetTree->RootWidget);
+			WidgetBlueprint->WidgetTree->ForEachWidget([&Signature](UWidget* Widget)
+			{
+				Signature = HashCombine(Signature, GetTypeHash(Widget->GetFName()));
+				Signature = HashCombine(Signature, GetTypeHash(Widget->GetClass()));
+				Signature = HashCombine(Signature, GetTypeHash(Widget->GetParent()));
+			});
+		}
+		return HashCombine(Signature, GetTypeHash(WidgetBlueprint->Bindings.Num()));
+	}
+
+	/** Export the whole tree into the index, keeping each widget's object so subtrees can be served from it */
+	void ExportWidgetTree(UWidgetBlueprint* WidgetBlueprint, FMCPWidgetBlueprintIndex& Index, uint32 Signature)
+	{
+		Index.WidgetJson.Reset();
+		Index.TreeJson.Reset();
+
+		TMultiMap<FName, FString> EventsByWidget;
+		for (const TPair<TPair<FName, FName>, TWeakObjectPtr<UK2Node_ComponentBoundEvent>>& Event : Index.BoundEvents)
+		{
+			if (Event.Value.IsValid())
+			{
+				EventsByWidget.Add(Event.Key.Key, Event.Key.Value.ToString());
+			}
+		}
+
+		TFunction<TSharedPtr<FJsonObject>(UWidget*)> WidgetToJson = [&](UWidget* Widget) -> TSharedPtr<FJsonObject>
+		{
+			TSharedPtr<FJsonObject> WidgetJson = MakeShared<FJsonObject>();
+			WidgetJson->SetStringField(TEXT("name"), Widget->GetName());
+			WidgetJson->SetStringField(TEXT("type"), Widget->GetClass()->GetName());
+			WidgetJson->SetBoolField(TEXT("is_variable"), Widget->bIsVariable);
+			WidgetJson->SetStringField(TEXT("visibility"), StaticEnum<ESlateVisibility>()->GetNameStringByValue(static_cast<int64>(Widget->GetVisibility())));
+			if (Widget->GetParent())
+			{
+				WidgetJson->SetStringField(TEXT("parent"), Widget->GetParent()->GetName());
+			}
+
+			if (const UTextBlock* TextBlock = Cast<UTextBlock>(Widget))
+			{
+				const FLinearColor Color = TextBlock->GetColorAndOpacity().GetSpecifiedColor();
+				WidgetJson->SetStringField(TEXT("text"), TextBlock->GetText().ToString());
+				WidgetJson->SetNumberField(TEXT("font_size"), TextBlock->GetFont().Size);
+				WidgetJson->SetField(TEXT("color"), MakeJsonNumbers({ Color.R, Color.G, Color.B, Color.A }));
+			}
+
+			if (Widget->Slot)
+			{
+				WidgetJson->SetObjectField(TEXT("slot"), SlotToJson(Widget->Slot));
+			}
+
+			TArray<FString> Events;
+			EventsByWidget.MultiFind(Widget->GetFName(), Events);
+			if (Events.Num() > 0)
+			{
+				TArray<TSharedPtr<FJsonValue>> EventValues;
+				for (const FString& Event : Events)
+				{
+					EventValues.Add(MakeShared<FJsonValueString>(Event));
+				}
+				WidgetJson->SetArrayField(TEXT("events"), EventValues);
+			}
+
+			TSharedPtr<FJsonObject> Bindings = MakeShared<FJsonObject>();
+			for (const FDelegateEditorBinding& Binding : WidgetBlueprint->Bindings)
+			{
+				if (Binding.ObjectName == Widget->GetName())
+				{
+					Bindings->SetStringField(Binding.PropertyName.ToString(), Binding.FunctionName.ToString());
+				}
+			}
+			if (Bindings->Values.Num() > 0)
+			{
+				WidgetJson->SetObjectField(TEXT("bindings"), Bindings);
+			}
+
+			if (const UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
+			{
+				TArray<TSharedPtr<FJsonValue>> Children;
+				for (int32 ChildIndex = 0; ChildIndex < Panel->GetChildrenCount(); ++ChildIndex)
+				{
+					if (UWidget* Child = Panel->GetChildAt(ChildIndex))
+					{
+						Children.Add(MakeShared<FJsonValueObject>(WidgetToJson(Child)));
+					}
+				}
+				WidgetJson->SetArrayField(TEXT("children"), Children);
+			}
+
+			Index.WidgetJson.Add(Widget->GetFName(), WidgetJson);
+			return WidgetJson;
+		};
+
+		if (WidgetBlueprint->WidgetTree && WidgetBlueprint->WidgetTree->RootWidget)
+		{
+			Index.TreeJson = WidgetToJson(WidgetBlueprint->WidgetTree->RootWidget);
+		}
+		Index.TreeSignature = Signature;
+	}
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleGetWidgetTree(const TSharedPtr<FJsonObject>& Params)
+{
+	// Get required parameters
+	FString BlueprintName;
+	if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+	}
+
+	// Get optional parameters
+	FString RootName;
+	Params->TryGetStringField(TEXT("root"), RootName);
+
+	FString WidgetClassName;
+	Params->TryGetStringField(TEXT("widget_class"), WidgetClassName);
+
+	bool bRefresh = false;
+	Params->TryGetBoolField(TEXT("refresh"), bRefresh);
+
+	FString ErrorMessage;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName, ErrorMessage);
+	if (!WidgetBlueprint)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+	}
+
+	UClass* WidgetClass = nullptr;
+	if (!WidgetClassName.IsEmpty())
+	{
+		WidgetClass = FindWidgetClass(WidgetClassName);
+		if (!WidgetClass)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FUnrealMCPCommonUtils::WithNameSuggestions(FString::Printf(TEXT("Unknown widget type: %s"), *WidgetClassName), WidgetClassName, TEXT("class")));
+		}
+	}
+
+	// The export is kept with the widget index, which compiles and object modifications invalidate; the signature
+	// catches structural edits made without either
+	TSharedPtr<FMCPWidgetBlueprintIndex> Index = GetWidgetIndex(WidgetBlueprint);
+	const uint32 Signature = GetWidgetTreeSignature(WidgetBlueprint);
+	const bool bCached = !bRefresh && Index->TreeSignature.IsSet() && Index->TreeSignature.GetValue() == Signature;
+	if (!bCached)
+	{
+		// Rebuild the index with the export so the bound events it lists are current
+		Index = GetWidgetIndex(WidgetBlueprint, true);
+		ExportWidgetTree(WidgetBlueprint, *Index, Signature);
+	}
+
+	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), true);
+	Response->SetStringField(TEXT("blueprint_name"), WidgetBlueprint->GetName());
+	Response->SetStringField(TEXT("path"), WidgetBlueprint->GetPathName());
+	Response->SetNumberField(TEXT("widget_count"), Index->WidgetJson.Num());
+	Response->SetBoolField(TEXT("cached"), bCached);
+
+	TSharedPtr<FJsonObject> Root = Index->TreeJson;
+	if (!RootName.IsEmpty())
+	{
+		const TSharedPtr<FJsonObject>* Subtree = Index->WidgetJson.Find(FName(*RootName));
+		if (!Subtree)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to find widget: %s"), *RootName));
+		}
+		Root = *Subtree;
+	}
+
+	if (!WidgetClass)
+	{
+		if (Root.IsValid())
+		{
+			Response->SetObjectField(TEXT("tree"), Root);
+		}
+		return Response;
+	}
+
+	// A flat list of matching widgets, in tree order, without their children
+	TArray<TSharedPtr<FJsonValue>> Widgets;
+	TFunction<void(const TSharedPtr<FJsonObject>&)> CollectMatches = [&](const TSharedPtr<FJsonObject>& WidgetJson)
+	{
+		UClass* Class = FindWidgetClass(WidgetJson->GetStringField(TEXT("type")));
+		if (Class && Class->IsChildOf(WidgetClass))
+		{
+			TSharedPtr<FJsonObject> Match = MakeShared<FJsonObject>(*WidgetJson);
+			Match->RemoveField(TEXT("children"));
+			Widgets.Add(MakeShared<FJsonValueObject>(Match));
+		}
+		const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+		if (WidgetJson->TryGetArrayField(TEXT("children"), Children))
+		{
+			for (const TSharedPtr<FJsonValue>& Child : *Children)
+			{
+				CollectMatches(Child->AsObject());
+			}
+		}
+	};
+	if (Root.IsValid())
+	{
+		CollectMatches(Root);
+	}
+
+	Response->SetArrayField(TEXT("widgets"), Widgets);
+	Response->SetNumberField(TEXT("match_count"), Widgets.Num());
+	return Response;
+}
@@ -57,6 +57,7 @@
 #include "Commands/UnrealMCPProjectCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
 #include "Commands/UnrealMCPUMGCommands.h"
+#include "Commands/UnrealMCPAssetCommands.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
@@ -69,6 +70,7 @@ UUnrealMCPBridge::UUnrealMCPBridge()
     BlueprintNodeCommands = MakeShared<FUnrealMCPBlueprintNodeCommands>();
     ProjectCommands = MakeShared<FUnrealMCPProjectCommands>();
     UMGCommands = MakeShared<FUnrealMCPUMGCommands>();
+    AssetCommands = MakeShared<FUnrealMCPAssetCommands>();
 }
 
 UUnrealMCPBridge::~UUnrealMCPBridge()
@@ -78,6 +80,7 @@ UUnrealMCPBridge::~UUnrealMCPBridge()
     BlueprintNodeCommands.Reset();
     ProjectCommands.Reset();
     UMGCommands.Reset();
+    AssetCommands.Reset();
 }
 
 // Initialize subsystem
@@ -94,6 +97,9 @@ void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
 
     // Start the server automatically
     StartServer();
+
+    // Index asset and class names in the background for "did you mean" suggestions
+    FUnrealMCPCommonUtils::StartNameIndexBuild();
 }
 
 // Clean up resources when subsystem is destroyed
@@ -101,6 +107,12 @@ void UUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
     StopServer();
+
+    // Don't drop saves that are still waiting in the queue
+    FUnrealMCPCommonUtils::FlushAssetSaves();
+    FUnrealMCPCommonUtils::StopNameIndex();
+    FUnrealMCPCommonUtils::ClearGraphExports();
+    FUnrealMCPCommonUtils::ClearSCSNodeIndices();
 }
 
 // Start the MCP server
@@ -232,18 +244,28 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                      CommandType == TEXT("set_actor_transform") ||
                      CommandType == TEXT("get_actor_properties") ||
                      CommandType == TEXT("set_actor_property") ||
+                     CommandType == TEXT("set_actor_materials") ||
               //       CommandType == TEXT("spawn_blueprint_actor") ||
                      CommandType == TEXT("focus_viewport") || 
-                     CommandType == TEXT("take_screenshot"))
+                     CommandType == TEXT("take_screenshot") ||
+                     CommandType == TEXT("wait_for_saves"))
             {
                 ResultJson = EditorCommands->HandleCommand(CommandType, Params);
             }
             // Blueprint Commands
             else if (CommandType == TEXT("create_blueprint") || 
+                     CommandType == TEXT("create_blueprint_from_spec") || 
                      CommandType == TEXT("add_component_to_blueprint") || 
+                     CommandType == TEXT("attach_components") || 
                      CommandType == TEXT("set_component_property") || 
                      CommandType == TEXT("set_physics_properties") || 
                      CommandType == TEXT("compile_blueprint") || 
+                     CommandType == TEXT("lint_blueprint") || 
+                     CommandType == TEXT("search_blueprints") || 
+                     CommandType == TEXT("get_blueprint_search") || 
+                     CommandType == TEXT("compile_blueprints") || 
+                     CommandType == TEXT("get_compile_job") || 
+                     CommandType == TEXT("flush_blueprint_compiles") || 
                      CommandType == TEXT("set_blueprint_property") || 
                      CommandType == TEXT("set_static_mesh_properties") ||
                      CommandType == TEXT("set_pawn_properties") ||
@@ -260,12 +282,19 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                      CommandType == TEXT("add_blueprint_input_action_node") ||
                      CommandType == TEXT("add_blueprint_function_node") ||
                      CommandType == TEXT("add_blueprint_get_component_node") ||
-                     CommandType == TEXT("add_blueprint_variable"))
+                     CommandType == TEXT("add_blueprint_variable") ||
+                     CommandType == TEXT("add_blueprint_variables") ||
+                     CommandType == TEXT("get_blueprint_graph") ||
+                     CommandType == TEXT("export_graph_nodes") ||
+                     CommandType == TEXT("import_graph_nodes") ||
+                     CommandType == TEXT("layout_graph"))
             {
                 ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
             }
             // Project Commands
-            else if (CommandType == TEXT("create_input_mapping"))
+            else if (CommandType == TEXT("create_input_mapping") ||
+                     CommandType == TEXT("create_input_mappings") ||
+                     CommandType == TEXT("create_enhanced_input"))
             {
                 ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
             }
@@ -275,10 +304,23 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                      CommandType == TEXT("add_button_to_widget") ||
                      CommandType == TEXT("bind_widget_event") ||
                      CommandType == TEXT("set_text_block_binding") ||
+                     CommandType == TEXT("build_widget_tree") ||
+                     CommandType == TEXT("get_widget_tree") ||
                      CommandType == TEXT("add_widget_to_viewport"))
             {
                 ResultJson = UMGCommands->HandleCommand(CommandType, Params);
             }
+            // Asset Commands
+            else if (CommandType == TEXT("find_assets") ||
+                     CommandType == TEXT("suggest") ||
+                     CommandType == TEXT("get_asset_dependencies") ||
+                     CommandType == TEXT("get_asset_referencers") ||
+                     CommandType == TEXT("move_assets") ||
+                     CommandType == TEXT("rename_assets") ||
+                     CommandType == TEXT("create_material_instances"))
+            {
+                ResultJson = AssetCommands->HandleCommand(CommandType, Params);
+            }
             else
             {
                 ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetIdentifier.h"
+
+/**
+ * Handler class for asset-related MCP commands
+ * Handles asset discovery through the asset registry without loading packages, batched asset moves and renames,
+ * and batched material instance creation
+ */
+class UNREALMCP_API FUnrealMCPAssetCommands
+{
+public:
+    FUnrealMCPAssetCommands();
+    ~FUnrealMCPAssetCommands();
+
+    // Handle asset commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    // Asset query commands
+    TSharedPtr<FJsonObject> HandleFindAssets(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSuggest(const TSharedPtr<FJsonObject>& Params);
+
+    // Dependency graph commands
+    TSharedPtr<FJsonObject> HandleGetAssetDependencies(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetAssetReferencers(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleDependencyQuery(const TSharedPtr<FJsonObject>& Params, bool bReferencers);
+
+    // Asset organization commands
+    TSharedPtr<FJsonObject> HandleMoveAssets(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleRenameAssets(const TSharedPtr<FJsonObject>& Params);
+    /** Rename or move every valid entry in one asset tools batch, then fix up the redirectors it left behind at once */
+    TSharedPtr<FJsonObject> RenameAssetBatch(const TSharedPtr<FJsonObject>& Params, bool bMove);
+
+    // Material commands
+    TSharedPtr<FJsonObject> HandleCreateMaterialInstances(const TSharedPtr<FJsonObject>& Params);
+
+    /** Subscribe to asset registry changes, which bump RegistryGeneration and invalidate the caches below */
+    void EnsureRegistryListeners();
+    void OnRegistryChanged();
+
+    /** The normalized filter that selects a query's assets; the page and the projected fields are not part of it */
+    struct FAssetQueryKey
+    {
+        FString PackagePath;
+        bool bRecursive = true;
+        FTopLevelAssetPath ClassPath;
+        bool bRecursiveClasses = true;
+        FString NamePattern;
+        TArray<TPair<FName, TOptional<FString>>> Tags;
+
+        bool operator==(const FAssetQueryKey& Other) const
+        {
+            return PackagePath == Other.PackagePath && bRecursive == Other.bRecursive && ClassPath == Other.ClassPath
+                && bRecursiveClasses == Other.bRecursiveClasses && NamePattern == Other.NamePattern && Tags == Other.Tags;
+        }
+    };
+
+    /** A registry query kept between pages so a cursor walks one stable, sorted result */
+    struct FAssetQuery
+    {
+        FAssetQueryKey Key;
+        uint64 Generation = 0;
+        TArray<FAssetData> Assets;
+    };
+
+    /** A package or searchable name reached while walking the dependency graph, and the node it was reached from */
+    struct FDependencyNode
+    {
+        FAssetIdentifier Id;
+        int32 Depth = 0;
+        int32 Via = INDEX_NONE;
+        bool bHard = false;
+    };
+
+    /** The root and edge filters a closure was walked with; depth is not part of it */
+    struct FDependencyClosureKey
+    {
+        FName RootPackage;
+        bool bReferencers = false;
+        bool bHard = true;
+        bool bSoft = true;
+        bool bSearchableNames = false;
+        bool bIncludeScript = false;
+
+        bool operator==(const FDependencyClosureKey& Other) const
+        {
+            return RootPackage == Other.RootPackage && bReferencers == Other.bReferencers && bHard == Other.bHard && bSoft == Other.bSoft
+                && bSearchableNames == Other.bSearchableNames && bIncludeScript == Other.bIncludeScript;
+        }
+    };
+
+    /**
+     * The part of a dependency or referencer closure walked so far, breadth first from Nodes[0]. A deeper query
+     * continues from the deepest level instead of starting over.
+     */
+    struct FDependencyClosure
+    {
+        FDependencyClosureKey Key;
+        uint64 Generation = 0;
+        int32 ExpandedDepth = 0;
+        bool bComplete = false;
+        bool bTruncated = false;
+        TArray<FDependencyNode> Nodes;
+        TMap<FAssetIdentifier, int32> NodeIndices;
+    };
+
+    uint64 RegistryGeneration = 0;
+    TArray<FDelegateHandle> RegistryHandles;
+    TArray<FAssetQuery> RecentQueries;
+    TArray<FDependencyClosure> RecentClosures;
+};
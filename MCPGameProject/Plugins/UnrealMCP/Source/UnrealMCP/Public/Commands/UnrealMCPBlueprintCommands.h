@@ -3,6 +3,10 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class UBlueprint;
+struct FMCPBlueprintCompileJob;
+struct FMCPBlueprintSearch;
+
 /**
  * Handler class for Blueprint-related MCP commands
  */
@@ -10,6 +14,7 @@ class UNREALMCP_API FUnrealMCPBlueprintCommands
 {
 public:
     FUnrealMCPBlueprintCommands();
+    ~FUnrealMCPBlueprintCommands();
 
     // Handle blueprint commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
@@ -17,10 +22,18 @@ public:
 private:
     // Specific blueprint command handlers
     TSharedPtr<FJsonObject> HandleCreateBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCreateBlueprintFromSpec(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddComponentToBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleAttachComponents(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetComponentProperty(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetPhysicsProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleCompileBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleLintBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSearchBlueprints(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetBlueprintSearch(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetCompileJob(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleFlushBlueprintCompiles(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetBlueprintProperty(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetStaticMeshProperties(const TSharedPtr<FJsonObject>& Params);
@@ -31,4 +44,13 @@ private:
                                                    const FString& ComponentName, const FString& MeshType,
                                                    const TArray<float>& Location, const TArray<float>& Rotation,
                                                    const TArray<float>& Scale, const TSharedPtr<FJsonObject>& ComponentProperties);
+
+    // Background compile jobs by id, kept until their results are fetched once completed
+    TMap<FString, TSharedPtr<FMCPBlueprintCompileJob>> CompileJobs;
+
+    // Find-in-Blueprints searches by id, running on their own thread until polled to completion
+    TMap<FString, TSharedPtr<FMCPBlueprintSearch>> BlueprintSearches;
+
+    // Blueprints validated with a skeleton-only compile that still need a full compile
+    TSet<TWeakObjectPtr<UBlueprint>> PendingFullCompiles;
 }; 
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class UEdGraph;
+class UEdGraphNode;
+
 /**
  * Handler class for Blueprint Node-related MCP commands
  */
@@ -21,7 +24,18 @@ private:
     TSharedPtr<FJsonObject> HandleAddBlueprintEvent(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintFunctionCall(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintVariable(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleAddBlueprintVariables(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintInputActionNode(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddBlueprintSelfReference(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindBlueprintNodes(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleExportGraphNodes(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleImportGraphNodes(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleLayoutGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Place a node created without an explicit position, remembering it until it is first connected
+    void AutoPlaceNode(UEdGraphNode* Node);
+
+    // Nodes per graph that were placed before they had any links; each moves next to the first node it gets connected to
+    TMap<TWeakObjectPtr<UEdGraph>, TSet<TWeakObjectPtr<UEdGraphNode>>> AutoPlacedNodes;
 }; 
\ No newline at end of file
@@ -16,6 +16,32 @@ class UK2Node_VariableSet;
 class UK2Node_InputAction;
 class UK2Node_Self;
 class UFunction;
+class FProperty;
+class USimpleConstructionScript;
+class USCS_Node;
+struct FEdGraphPinType;
+struct FBPVariableDescription;
+struct FAssetData;
+
+/**
+ * A property resolved from a dotted/indexed path such as
+ * "StaticMeshComponent.BodyInstance.MassInKgOverride" or "Tags[2]"
+ */
+struct FMCPResolvedProperty
+{
+    FProperty* Property = nullptr;
+    void* ValuePtr = nullptr;
+    UObject* Owner = nullptr;
+};
+
+/** A ranked near match for a mistyped asset or class name */
+struct FMCPNameSuggestion
+{
+    FString Name;
+    FString Path;
+    FString Kind;
+    float Score = 0.0f;
+};
 
 /**
  * Common utilities for UnrealMCP commands
@@ -40,7 +66,86 @@ public:
     static UBlueprint* FindBlueprint(const FString& BlueprintName);
     static UBlueprint* FindBlueprintByName(const FString& BlueprintName);
     static UEdGraph* FindOrCreateEventGraph(UBlueprint* Blueprint);
+    /** Find any graph of a blueprint (event, function, macro or sub-graph) by name; an empty name means the event graph */
+    static UEdGraph* FindGraph(UBlueprint* Blueprint, const FString& GraphName);
+    /** Like FindGraph, but never creates the event graph; for commands that only read the blueprint */
+    static UEdGraph* FindExistingGraph(UBlueprint* Blueprint, const FString& GraphName);
+
+    /**
+     * Compile a blueprint unless it is up to date. A blueprint is up to date when the editor has not marked it
+     * dirty and its content hash (graphs, variables, SCS nodes and class defaults) matches the one recorded at
+     * its last compile through this function; the recorded status and messages are returned in that case.
+     */
+    static TSharedPtr<FJsonObject> CompileBlueprint(UBlueprint* Blueprint, bool bForce = false);
+    static uint32 GetBlueprintContentHash(UBlueprint* Blueprint);
+    /** Hash of a graph's nodes, pins, defaults and links; layout adds node positions, comments and pin visibility */
+    static uint32 GetGraphContentHash(const UEdGraph* Graph, bool bIncludeLayout = false);
+    static bool IsBlueprintUpToDate(UBlueprint* Blueprint);
+    /**
+     * Regenerate only the skeleton class and validate every graph node against it. Messages carry the graph and node
+     * they came from. The blueprint is left dirty, since no bytecode is generated.
+     */
+    static TSharedPtr<FJsonObject> ValidateBlueprintSkeleton(UBlueprint* Blueprint);
+    /**
+     * Static checks over every graph without compiling: orphaned pins, incompatible links, unresolved wildcards, unreachable
+     * or unused nodes, missing call targets and by-ref inputs, and references to variables, functions or events that no longer exist.
+     */
+    static TSharedPtr<FJsonObject> LintBlueprint(UBlueprint* Blueprint);
+    /** Compile several blueprints through the compilation manager queue so they share a single reinstancing pass */
+    static TArray<TSharedPtr<FJsonValue>> CompileBlueprints(const TArray<UBlueprint*>& Blueprints);
     
+    // Blueprint variable utilities
+    /**
+     * Parse a variable type into a pin type. The type is either a name such as "Boolean", "Float" or "Vector", or an object
+     * {category, sub_type, container, value_type} where category also covers Object, Class, SoftObject, SoftClass,
+     * Interface, Struct and Enum (naming the type in sub_type), container is Array, Set or Map, and value_type is the map value type.
+     */
+    static bool ParsePinType(const TSharedPtr<FJsonValue>& TypeValue, FEdGraphPinType& OutPinType, FString& OutErrorMessage);
+    /** Describe a new member variable the way the blueprint editor would, without adding it or modifying the blueprint */
+    static FBPVariableDescription MakeVariableDescription(const FName& VariableName, const FEdGraphPinType& PinType, const FString& DefaultValue = FString());
+
+    // Graph export utilities
+    /** Describe a pin type in the form ParsePinType accepts, falling back to the raw category for exec, wildcard and delegate pins */
+    static TSharedPtr<FJsonObject> PinTypeToJson(const FEdGraphPinType& PinType);
+    /**
+     * Export the nodes of a graph with their pins, defaults and links, identified by node GUID. The export is cached per
+     * graph and rebuilt only after the graph reports a change, a node or the graph is modified, or its blueprint is.
+     */
+    static TArray<TSharedPtr<FJsonValue>> GetGraphNodesJson(UEdGraph* Graph);
+    static void ClearGraphExports();
+
+    // Graph node index utilities
+    /**
+     * Find nodes in any graph of a blueprint by node class (subclasses included) and/or referenced member, i.e. the function,
+     * event or variable a node refers to; NAME_None skips that filter. Served from a per-blueprint index that is rebuilt
+     * after graph or blueprint change notifications.
+     */
+    static TArray<UEdGraphNode*> FindNodes(UBlueprint* Blueprint, const FName& NodeClassName = NAME_None, const FName& MemberName = NAME_None);
+    /** The function, event or variable a node refers to, or NAME_None */
+    static FName GetNodeMemberName(const UEdGraphNode* Node);
+
+    // Graph layout utilities
+    /**
+     * Lay out a graph in layers along its exec and data links (cycle removal, longest-path layering, barycenter ordering).
+     * Chains that aren't connected to each other are stacked vertically, and comment boxes are left in place.
+     */
+    static TSharedPtr<FJsonObject> LayoutGraph(UEdGraph* Graph, const FVector2D& Spacing = FVector2D(80.0f, 40.0f));
+    /**
+     * Place a node created without an explicit position next to the node it is linked to, or in a new row below the graph
+     * when it isn't linked yet. Returns false in that case, so the caller can move it with PlaceNextToLinkedNode once it is.
+     */
+    static bool AutoPlaceNode(UEdGraphNode* Node);
+    /** Move a node right of the node feeding its first linked input, or left of the node its first linked output feeds */
+    static bool PlaceNextToLinkedNode(UEdGraphNode* Node);
+
+    // Component node utilities
+    /**
+     * Find an SCS node by variable name through a per-construction-script name index instead of scanning all nodes.
+     * The index is rebuilt only after the script or one of its nodes is modified.
+     */
+    static USCS_Node* FindSCSNode(USimpleConstructionScript* SCS, const FName& VariableName);
+    static void ClearSCSNodeIndices();
+
     // Blueprint node utilities
     static UK2Node_Event* CreateEventNode(UEdGraph* Graph, const FString& EventName, const FVector2D& Position);
     static UK2Node_CallFunction* CreateFunctionCallNode(UEdGraph* Graph, UFunction* Function, const FVector2D& Position);
@@ -56,4 +161,79 @@ public:
     // Property utilities
     static bool SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                  const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+    /** Like SetObjectProperty, and reports whether the property's value actually changed */
+    static bool UpdateObjectProperty(UObject* Object, const FString& PropertyPath,
+                                   const TSharedPtr<FJsonValue>& Value, bool& bOutChanged, FString& OutErrorMessage);
+    static bool SetPropertyValue(FProperty* Property, void* PropertyAddr, UObject* Owner,
+                                 const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+
+    /**
+     * Resolve a property path against an object. Segments are separated by '.', and may carry
+     * an index ("Tags[2]"). Object properties are followed into the referenced object, and the
+     * first segment may also name a component of an actor or an SCS node of a blueprint CDO.
+     * Resolved chains are cached per (class, path).
+     */
+    static bool ResolvePropertyPath(UObject* Object, const FString& PropertyPath,
+                                    FMCPResolvedProperty& OutResolved, FString& OutErrorMessage);
+
+    /**
+     * Export the editable properties of an object. Structs and containers are expanded up to MaxDepth
+     * levels and exported as text beyond that. Categories, when non-empty, restricts the top level
+     * properties to those categories (and their sub-categories). Property layouts are cached per class.
+     */
+    static TSharedPtr<FJsonObject> PropertiesToJson(UObject* Object, int32 MaxDepth = 1, const TArray<FString>& Categories = TArray<FString>());
+    static TSharedPtr<FJsonValue> PropertyValueToJson(FProperty* Property, const void* ValuePtr, int32 MaxDepth = 1);
+
+    // Asset lookup utilities
+    /**
+     * Resolve an asset to its package name. Accepts a package or object path ("/Game/Meshes/SM_Rock.SM_Rock"), or an asset
+     * name that is unique in the registry.
+     */
+    static bool ResolveAssetPackage(const FString& AssetName, FName& OutPackageName, FString& OutErrorMessage);
+    /** The asset data of a package's primary asset, the one named after the package */
+    static bool GetPrimaryAsset(const FName& PackageName, FAssetData& OutAsset);
+    /** Resolve an asset name or path as ResolveAssetPackage does and load the asset, which must be an AssetClass */
+    static UObject* LoadResolvedAsset(const FString& AssetName, UClass* AssetClass, FString& OutErrorMessage);
+    template <typename TAsset>
+    static TAsset* LoadResolvedAsset(const FString& AssetName, FString& OutErrorMessage)
+    {
+        return static_cast<TAsset*>(LoadResolvedAsset(AssetName, TAsset::StaticClass(), OutErrorMessage));
+    }
+
+    // Asset creation utilities
+    /**
+     * Find the asset at PackageName.AssetName before creating one there. Loaded objects are checked as well as the asset
+     * registry, since new assets aren't registered until they are announced. OutAsset is null when the path is free;
+     * fails when the path holds an object of another class or one that is being deleted.
+     */
+    static bool FindAssetForCreate(const FString& PackageName, const FString& AssetName, UClass* AssetClass, UObject*& OutAsset, FString& OutErrorMessage);
+
+    // Asset save utilities
+    /**
+     * Queue the package of an asset for saving. Queued packages are checked out and serialized together shortly after
+     * on the game thread with the file writes handed to a worker, and repeated requests for the same package before then
+     * result in a single save.
+     */
+    static void QueueAssetSave(UObject* Asset);
+    /** Save every queued package now, block until the worker has written every file and report what was saved since the last flush */
+    static TSharedPtr<FJsonObject> FlushAssetSaves();
+
+    // Name suggestion utilities
+    /**
+     * Start building the fuzzy name index over asset names (from the asset registry) and loaded class names once the
+     * registry has finished its initial scan. Names are gathered on the game thread and indexed by trigram on a worker;
+     * registry changes keep asset names up to date, and class names are resynced after module loads, compiles and GC.
+     */
+    static void StartNameIndexBuild();
+    static void StopNameIndex();
+    /**
+     * Rank asset and class names similar to Query. Kind is "class", "asset" or an asset class name such as "StaticMesh"
+     * ("Blueprint" also covers widget blueprints); empty means any. Returns nothing while the index is still building
+     * unless bWaitForIndex is set.
+     */
+    static TArray<FMCPNameSuggestion> SuggestNames(const FString& Query, const FString& Kind = FString(), int32 MaxResults = 10, bool bWaitForIndex = false);
+    /** Append "Did you mean: ...?" with the best suggestions for Query to a not-found message */
+    static FString WithNameSuggestions(const FString& Message, const FString& Query, const FString& Kind = FString());
+    /** "Blueprint not found: Name" with suggestions among blueprint assets */
+    static FString BlueprintNotFoundError(const FString& BlueprintName);
 }; 
\ No newline at end of file
@@ -17,4 +17,6 @@ public:
 private:
     // Specific project command handlers
     TSharedPtr<FJsonObject> HandleCreateInputMapping(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCreateInputMappings(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCreateEnhancedInput(const TSharedPtr<FJsonObject>& Params);
 }; 
\ No newline at end of file
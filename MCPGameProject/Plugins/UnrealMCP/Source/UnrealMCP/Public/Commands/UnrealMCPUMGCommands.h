@@ -3,6 +3,11 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class UWidget;
+class UWidgetBlueprint;
+class UK2Node_ComponentBoundEvent;
+struct FMCPWidgetBlueprintIndex;
+
 /**
  * Handles UMG (Widget Blueprint) related MCP commands
  * Responsible for creating and modifying UMG Widget Blueprints,
@@ -12,6 +17,7 @@ class UNREALMCP_API FUnrealMCPUMGCommands
 {
 public:
     FUnrealMCPUMGCommands();
+    ~FUnrealMCPUMGCommands();
 
     /**
      * Handle UMG-related commands
@@ -22,9 +28,51 @@ public:
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
 private:
+    /**
+     * Resolve a Widget Blueprint by content path ("/Game/UI/WBP_Hud") or by name, looking in /Game/Widgets first
+     * and then for a unique widget blueprint of that name anywhere. Resolved blueprints are cached.
+     * @param BlueprintName - Name or content path of the Widget Blueprint
+     * @param OutErrorMessage - Why the blueprint couldn't be resolved
+     * @return The Widget Blueprint, or nullptr
+     */
+    UWidgetBlueprint* FindWidgetBlueprint(const FString& BlueprintName, FString& OutErrorMessage);
+
+    /**
+     * Get the widget-name and bound-event index of a Widget Blueprint, rebuilding it if the blueprint
+     * was compiled or changed since it was built
+     * @param WidgetBlueprint - The Widget Blueprint to index
+     * @param bForceRebuild - Rebuild even if the index looks current
+     * @return The index
+     */
+    TSharedPtr<FMCPWidgetBlueprintIndex> GetWidgetIndex(UWidgetBlueprint* WidgetBlueprint, bool bForceRebuild = false);
+
+    /**
+     * Invalidate the index of the Widget Blueprint that owns a modified object, so edits to widget properties,
+     * slots or bindings that don't compile the blueprint aren't served from a stale get_widget_tree export
+     * @param Object - The object that was modified or had a property changed
+     */
+    void InvalidateWidgetIndex(UObject* Object);
+
+    /**
+     * Find a widget in a Widget Blueprint's tree through the widget index
+     * @param WidgetBlueprint - The Widget Blueprint to search
+     * @param WidgetName - Name of the widget
+     * @return The widget, or nullptr
+     */
+    UWidget* FindWidget(UWidgetBlueprint* WidgetBlueprint, const FName& WidgetName);
+
+    /**
+     * Find the event node bound to a widget's event through the widget index
+     * @param WidgetBlueprint - The Widget Blueprint to search
+     * @param WidgetName - Name of the widget variable
+     * @param EventName - Name of the widget's delegate, e.g. "OnClicked"
+     * @return The event node, or nullptr
+     */
+    UK2Node_ComponentBoundEvent* FindBoundEvent(UWidgetBlueprint* WidgetBlueprint, const FName& WidgetName, const FName& EventName);
+
     /**
      * Create a new UMG Widget Blueprint
-     * @param Params - Must include "name" for the blueprint name
+     * @param Params - Must include "name" for the blueprint name, may include "path" for the content folder
      * @return JSON response with the created blueprint details
      */
     TSharedPtr<FJsonObject> HandleCreateUMGWidgetBlueprint(const TSharedPtr<FJsonObject>& Params);
@@ -79,4 +127,38 @@ private:
      * @return JSON response with the binding details
      */
     TSharedPtr<FJsonObject> HandleSetTextBlockBinding(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Build a whole widget hierarchy from a nested spec, then compile and save the blueprint once
+     * @param Params - Must include:
+     *                "blueprint_name" - Name of the target Widget Blueprint
+     *                "root" - Widget spec {type, name, text, font_size, color, properties, slot, events, bindings, children}
+     *                "replace" - Replace the existing tree instead of adding to it (optional, default false)
+     *                "parent" - Panel to add the tree to when not replacing (optional, default the root widget)
+     * @return JSON response with the created widgets, non-fatal errors and the compile result; a replace also
+     *         reports the event nodes and bindings of removed widgets as "removed_events" and "removed_bindings"
+     */
+    TSharedPtr<FJsonObject> HandleBuildWidgetTree(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Export the widget hierarchy with slot layout, visibility, text, bound events and property bindings.
+     * The export is cached per Widget Blueprint until it compiles, changes or its widgets are added, removed or moved.
+     * @param Params - Must include:
+     *                "blueprint_name" - Name or content path of the Widget Blueprint
+     *                "root" - Name of the widget whose subtree to return (optional)
+     *                "widget_class" - Return a flat list of widgets of this class instead of the tree (optional)
+     *                "refresh" - Bypass the cached export (optional)
+     * @return JSON response with the tree, or the matching widgets
+     */
+    TSharedPtr<FJsonObject> HandleGetWidgetTree(const TSharedPtr<FJsonObject>& Params);
+
+    /** Resolved Widget Blueprints by the name or path they were requested with */
+    TMap<FString, TWeakObjectPtr<UWidgetBlueprint>> WidgetBlueprintCache;
+
+    /** Widget-name and bound-event indexes per Widget Blueprint */
+    TMap<TWeakObjectPtr<UWidgetBlueprint>, TSharedPtr<FMCPWidgetBlueprintIndex>> WidgetIndices;
+
+    /** Object change listeners, registered with the first index */
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
 }; 
\ No newline at end of file
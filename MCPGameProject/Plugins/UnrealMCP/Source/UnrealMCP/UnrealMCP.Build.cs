@@ -51,7 +51,10 @@ public class UnrealMCP : ModuleRules
 				"KismetCompiler",
 				"BlueprintGraph",
 				"Projects",
-				"AssetRegistry"
+				"AssetRegistry",
+				"AssetTools",
+				"EnhancedInput",
+				"SourceControl"
 			}
 		);
 		
@@ -0,0 +1,388 @@
+"""
+Asset Tools for Unreal MCP.
+
+This module provides tools for discovering and organizing assets through the asset registry.
+"""
+
+import logging
+from typing import Dict, List, Any
+from mcp.server.fastmcp import FastMCP, Context
+
+# Get logger
+logger = logging.getLogger("UnrealMCP")
+
+def register_asset_tools(mcp: FastMCP):
+    """Register asset tools with the MCP server."""
+
+    @mcp.tool()
+    def find_assets(
+        ctx: Context,
+        path: str = "/Game",
+        recursive: bool = True,
+        asset_class: str = "",
+        recursive_classes: bool = True,
+        name: str = "",
+        tags: Dict[str, str] = None,
+        fields: List[str] = None,
+        limit: int = 100,
+        cursor: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Find assets through the asset registry, without loading them.
+        
+        Args:
+            path: Content folder to search
+            recursive: Include sub-folders
+            asset_class: Asset class, e.g. "StaticMesh", "Blueprint", "/Script/Engine.Material"
+            recursive_classes: Include subclasses of asset_class
+            name: Asset name glob, e.g. "SM_*" or "*Door*"
+            tags: Asset registry tag filters, e.g. {"ParentClass": "..."}; an empty value only requires the tag
+            fields: Fields to return per asset: name, path, package, package_path, class, class_path, tags,
+                    or "tag:<Name>" for a single tag (default: name, path, class)
+            limit: Page size (max 1000)
+            cursor: The next_cursor of a previous page of the same query
+            
+        Returns:
+            Dict containing the page of assets, the total match count and next_cursor when more remain
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "path": path,
+                "recursive": recursive,
+                "recursive_classes": recursive_classes,
+                "limit": limit
+            }
+            
+            if asset_class:
+                params["class"] = asset_class
+            if name:
+                params["name"] = name
+            if tags:
+                params["tags"] = tags
+            if fields:
+                params["fields"] = fields
+            if cursor:
+                params["cursor"] = cursor
+            
+            logger.info(f"Finding assets with params: {params}")
+            response = unreal.send_command("find_assets", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Find assets response: {response.get('result', {}).get('total', 0)} matches")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error finding assets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def suggest(
+        ctx: Context,
+        query: str,
+        kind: str = "",
+        limit: int = 10
+    ) -> Dict[str, Any]:
+        """
+        Suggest asset and class names similar to a possibly misspelled name.
+        
+        Args:
+            query: The name to look up, e.g. "BP_Charcter" or "StaticMeshComponnet"
+            kind: "class", "asset" or an asset class such as "Blueprint" or "StaticMesh"; empty for any
+            limit: Maximum number of suggestions
+            
+        Returns:
+            Dict containing the ranked suggestions with name, path, kind and score
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "query": query,
+                "limit": limit
+            }
+            if kind:
+                params["kind"] = kind
+            
+            logger.info(f"Suggesting names with params: {params}")
+            response = unreal.send_command("suggest", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Suggest response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error suggesting names: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_asset_dependencies(
+        ctx: Context,
+        asset: str,
+        depth: int = 1,
+        hard: bool = True,
+        soft: bool = True,
+        searchable_names: bool = False,
+        include_script: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Get the packages an asset depends on, from the asset registry without loading anything.
+        
+        Args:
+            asset: Asset name, or package/object path such as "/Game/Meshes/SM_Rock"
+            depth: How many levels to follow; 0 for the full transitive closure
+            hard: Follow hard package references
+            soft: Follow soft package references
+            searchable_names: Also follow searchable name references (struct members, data table rows)
+            include_script: Include /Script (native class) packages
+            
+        Returns:
+            Dict containing the packages with their depth, the package they were reached through and whether the reference is hard
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "asset": asset,
+                "depth": depth,
+                "hard": hard,
+                "soft": soft,
+                "searchable_names": searchable_names,
+                "include_script": include_script
+            }
+            
+            logger.info(f"Getting asset dependencies with params: {params}")
+            response = unreal.send_command("get_asset_dependencies", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Get asset dependencies response: {response.get('result', {}).get('count', 0)} packages")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error getting asset dependencies: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_asset_referencers(
+        ctx: Context,
+        asset: str,
+        depth: int = 1,
+        hard: bool = True,
+        soft: bool = True,
+        searchable_names: bool = False,
+        include_script: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Get the packages that reference an asset, e.g. before deleting or moving it, without loading anything.
+        
+        Args:
+            asset: Asset name, or package/object path such as "/Game/Meshes/SM_Rock"
+            depth: How many levels to follow; 0 for the full transitive closure
+            hard: Follow hard package references
+            soft: Follow soft package references
+            searchable_names: Also follow searchable name references (struct members, data table rows)
+            include_script: Include /Script (native class) packages
+            
+        Returns:
+            Dict containing the packages with their depth, the package they were reached through and whether the reference is hard
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "asset": asset,
+                "depth": depth,
+                "hard": hard,
+                "soft": soft,
+                "searchable_names": searchable_names,
+                "include_script": include_script
+            }
+            
+            logger.info(f"Getting asset referencers with params: {params}")
+            response = unreal.send_command("get_asset_referencers", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Get asset referencers response: {response.get('result', {}).get('count', 0)} packages")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error getting asset referencers: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def move_assets(
+        ctx: Context,
+        moves: List[Dict[str, str]],
+        fixup_redirectors: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Move many assets to other folders in one batch, fixing up references once at the end.
+        
+        Args:
+            moves: List of {"source": asset name or path, "destination": "/Game/Folder", "name": optional new name}
+            fixup_redirectors: Point referencers at the new paths and delete the redirectors left behind
+            
+        Returns:
+            Dict containing the moved assets, per-entry errors and the progress of each phase
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "moves": moves,
+                "fixup_redirectors": fixup_redirectors
+            }
+            
+            logger.info(f"Moving {len(moves)} assets")
+            response = unreal.send_command("move_assets", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Move assets response: {response.get('result', {}).get('count', 0)} moved")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error moving assets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def rename_assets(
+        ctx: Context,
+        renames: List[Dict[str, str]],
+        fixup_redirectors: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Rename many assets in place in one batch, fixing up references once at the end.
+        
+        Args:
+            renames: List of {"source": asset name or path, "new_name": "NewName"}
+            fixup_redirectors: Point referencers at the new paths and delete the redirectors left behind
+            
+        Returns:
+            Dict containing the renamed assets, per-entry errors and the progress of each phase
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "renames": renames,
+                "fixup_redirectors": fixup_redirectors
+            }
+            
+            logger.info(f"Renaming {len(renames)} assets")
+            response = unreal.send_command("rename_assets", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Rename assets response: {response.get('result', {}).get('count', 0)} renamed")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error renaming assets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def create_material_instances(
+        ctx: Context,
+        parent: str,
+        instances: List[Dict[str, Any]],
+        path: str = "/Game/Materials",
+        overwrite: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Create many material instances of one parent material with parameter overrides.
+        
+        Args:
+            parent: Parent material name or path
+            instances: List of {"name": "MI_Red", "scalars": {"Roughness": 0.3}, "vectors": {"BaseColor": [1, 0, 0]},
+                       "textures": {"Albedo": "/Game/Textures/T_Rock"}}
+            path: Content folder for the new instances
+            overwrite: Replace the parent and overrides of instances that already exist instead of skipping them
+            
+        Returns:
+            Dict containing the created, updated and skipped instance paths, and errors for names that could not be used
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "parent": parent,
+                "instances": instances,
+                "path": path,
+                "overwrite": overwrite
+            }
+            
+            logger.info(f"Creating {len(instances)} material instances of {parent}")
+            response = unreal.send_command("create_material_instances", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Create material instances response: {response.get('result', {}).get('count', 0)} instances")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error creating material instances: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    logger.info("Asset tools registered successfully")
@@ -5,6 +5,7 @@ This module provides tools for creating and manipulating Blueprint assets in Unr
 """
 
 import logging
+import time
 from typing import Dict, List, Any
 from mcp.server.fastmcp import FastMCP, Context
 
@@ -47,6 +48,64 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def create_blueprint_from_spec(
+        ctx: Context,
+        name: str,
+        parent_class: str = "",
+        components: List[Dict[str, Any]] = [],
+        variables: List[Dict[str, Any]] = [],
+        defaults: Dict[str, Any] = {}
+    ) -> Dict[str, Any]:
+        """
+        Create or update a Blueprint from a declarative spec with a single compile and save.
+        
+        Applying the same spec again changes nothing; only differences from the existing
+        Blueprint are applied.
+        
+        Args:
+            name: Name of the Blueprint
+            parent_class: Parent class for a new Blueprint, or to reparent an existing one (default: Actor)
+            components: List of {"name", "type", "parent", "location", "rotation", "scale", "properties"}
+                        where properties maps property paths to values
+            variables: List of {"name", "type", "default_value", "category"}
+            defaults: Class default values by property path
+            
+        Returns:
+            Dict with created, the list of applied changes, errors and the compile result
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "name": name,
+                "components": components,
+                "variables": variables,
+                "defaults": defaults
+            }
+            if parent_class:
+                params["parent_class"] = parent_class
+            
+            logger.info(f"Applying blueprint spec for {name}")
+            response = unreal.send_command("create_blueprint_from_spec", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Blueprint spec response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error applying blueprint spec: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     @mcp.tool()
     def add_component_to_blueprint(
         ctx: Context,
@@ -56,7 +115,8 @@ def register_blueprint_tools(mcp: FastMCP):
         location: List[float] = [],
         rotation: List[float] = [],
         scale: List[float] = [],
-        component_properties: Dict[str, Any] = {}
+        component_properties: Dict[str, Any] = {},
+        parent_component: str = ""
     ) -> Dict[str, Any]:
         """
         Add a component to a Blueprint.
@@ -69,6 +129,8 @@ def register_blueprint_tools(mcp: FastMCP):
             rotation: [Pitch, Yaw, Roll] values for component's rotation
             scale: [X, Y, Z] values for component's scale
             component_properties: Additional properties to set on the component
+            parent_component: Scene component to attach to, either a component of this Blueprint
+                              or one inherited from a native parent class (default: root)
         
         Returns:
             Information about the added component
@@ -90,6 +152,9 @@ def register_blueprint_tools(mcp: FastMCP):
             if component_properties and len(component_properties) > 0:
                 params["component_properties"] = component_properties
             
+            if parent_component:
+                params["parent_component"] = parent_component
+            
             # Validate location, rotation, and scale formats
             for param_name in ["location", "rotation", "scale"]:
                 param_value = params[param_name]
@@ -119,6 +184,51 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def attach_components(
+        ctx: Context,
+        blueprint_name: str,
+        attachments: List[Dict[str, str]]
+    ) -> Dict[str, Any]:
+        """
+        Reparent several components of a Blueprint with a single compile.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            attachments: List of {"component": name, "parent": name}, applied in order.
+                         An empty parent makes the component a root component.
+        
+        Returns:
+            Per-attachment results and the number of components attached
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "blueprint_name": blueprint_name,
+                "attachments": attachments
+            }
+            
+            logger.info(f"Attaching components in blueprint {blueprint_name}: {attachments}")
+            response = unreal.send_command("attach_components", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Attach components response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error attaching components: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     @mcp.tool()
     def set_static_mesh_properties(
         ctx: Context,
@@ -174,7 +284,18 @@ def register_blueprint_tools(mcp: FastMCP):
         property_name: str,
         property_value,
     ) -> Dict[str, Any]:
-        """Set a property on a component in a Blueprint."""
+        """
+        Set a property on a component in a Blueprint.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            component_name: Name of the component; pass "" to name it in the first segment of property_name
+            property_name: Property name or path, e.g. "BodyInstance.MassInKgOverride" or "ComponentTags[0]"
+            property_value: Value to set the property to
+            
+        Returns:
+            Response indicating success or failure
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -185,10 +306,11 @@ def register_blueprint_tools(mcp: FastMCP):
             
             params = {
                 "blueprint_name": blueprint_name,
-                "component_name": component_name,
                 "property_name": property_name,
                 "property_value": property_value
             }
+            if component_name:
+                params["component_name"] = component_name
             
             logger.info(f"Setting component property with params: {params}")
             response = unreal.send_command("set_component_property", params)
@@ -253,9 +375,22 @@ def register_blueprint_tools(mcp: FastMCP):
     @mcp.tool()
     def compile_blueprint(
         ctx: Context,
-        blueprint_name: str
+        blueprint_name: str,
+        force: bool = False,
+        mode: str = "full"
     ) -> Dict[str, Any]:
-        """Compile a Blueprint."""
+        """
+        Compile a Blueprint.
+        
+        The compile is skipped when the Blueprint has not changed since its last compile;
+        the previous status and messages are returned with skipped set to true.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            force: Compile even if the Blueprint is up to date
+            mode: "full", or "skeleton" to only regenerate the skeleton class and validate the
+                  graphs. Skeleton-validated Blueprints are fully compiled by flush_blueprint_compiles.
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -265,7 +400,9 @@ def register_blueprint_tools(mcp: FastMCP):
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
             
             params = {
-                "blueprint_name": blueprint_name
+                "blueprint_name": blueprint_name,
+                "force": force,
+                "mode": mode
             }
             
             logger.info(f"Compiling blueprint: {blueprint_name}")
@@ -283,6 +420,245 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def lint_blueprint(
+        ctx: Context,
+        blueprint_name: str
+    ) -> Dict[str, Any]:
+        """
+        Check a Blueprint's graphs for common mistakes without compiling it.
+        
+        Reports orphaned pins, incompatible links, unresolved wildcards, nodes that never run or whose
+        results are unused, calls missing a target or a by-ref input, and references to variables,
+        functions or events that no longer exist. Each issue has a severity, code, graph, node and pin.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "blueprint_name": blueprint_name
+            }
+            
+            logger.info(f"Linting blueprint: {blueprint_name}")
+            response = unreal.send_command("lint_blueprint", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Lint blueprint response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error linting blueprint: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def search_blueprints(
+        ctx: Context,
+        query: str = "",
+        function_name: str = "",
+        variable_name: str = "",
+        max_results: int = 50,
+        wait: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Search every Blueprint in the project without loading them, using the editor's Find-in-Blueprints data.
+        
+        Args:
+            query: Optional Find-in-Blueprints query, plain text or e.g. 'Nodes(Name=Print)'
+            function_name: Optional function that a node must call (e.g. "SetActorHiddenInGame")
+            variable_name: Optional member variable name (e.g. "Health")
+            max_results: Maximum number of Blueprints to return
+            wait: Poll until the search completes; otherwise return a search_id to poll with get_blueprint_search
+            
+        Returns:
+            Matching Blueprints with the graphs and nodes that matched
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "max_results": max_results
+            }
+            if query:
+                params["query"] = query
+            if function_name:
+                params["function_name"] = function_name
+            if variable_name:
+                params["variable_name"] = variable_name
+            
+            logger.info(f"Searching blueprints: {params}")
+            response = unreal.send_command("search_blueprints", params)
+            
+            # The search runs on its own thread in the editor; poll it rather than blocking the editor.
+            # The editor stops a search after 10 seconds, so the deadline only guards against a stuck connection
+            deadline = time.monotonic() + 30.0
+            while (wait and response and response.get("result", {}).get("state") == "running"
+                   and time.monotonic() < deadline):
+                time.sleep(0.1)
+                response = unreal.send_command("get_blueprint_search", {"search_id": response["result"]["search_id"]})
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Found {response.get('result', {}).get('blueprint_count', 0)} blueprints")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error searching blueprints: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_blueprint_search(
+        ctx: Context,
+        search_id: str
+    ) -> Dict[str, Any]:
+        """Get the state of a search_blueprints search, with its results once it has completed."""
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            response = unreal.send_command("get_blueprint_search", {"search_id": search_id})
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error getting blueprint search: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def compile_blueprints(
+        ctx: Context,
+        blueprint_names: List[str] = [],
+        path: str = "",
+        dirty_only: bool = False,
+        background: bool = False,
+        batch_size: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Compile several Blueprints together with a single reinstancing pass.
+        
+        Args:
+            blueprint_names: Names of Blueprints to compile
+            path: Content path whose Blueprints are compiled recursively, e.g. "/Game/Blueprints"
+            dirty_only: Skip Blueprints that are up to date since their last compile
+            background: Compile one batch per editor tick and return a job_id to poll with get_compile_job
+            batch_size: Blueprints per batch (default: all at once, or 16 in the background)
+            
+        Returns:
+            Job state with per-Blueprint status in results
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "dirty_only": dirty_only,
+                "background": background,
+                "batch_size": batch_size
+            }
+            if blueprint_names:
+                params["blueprint_names"] = blueprint_names
+            if path:
+                params["path"] = path
+            
+            logger.info(f"Compiling blueprints: {blueprint_names or path}")
+            response = unreal.send_command("compile_blueprints", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Compile blueprints response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error compiling blueprints: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def flush_blueprint_compiles(ctx: Context) -> Dict[str, Any]:
+        """Fully compile every Blueprint that was only validated with a skeleton compile."""
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            response = unreal.send_command("flush_blueprint_compiles", {})
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Flush blueprint compiles response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error flushing blueprint compiles: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_compile_job(
+        ctx: Context,
+        job_id: str
+    ) -> Dict[str, Any]:
+        """Get the progress and results of a background compile_blueprints job."""
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            response = unreal.send_command("get_compile_job", {"job_id": job_id})
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error getting compile job: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def set_blueprint_property(
         ctx: Context,
@@ -295,7 +671,7 @@ def register_blueprint_tools(mcp: FastMCP):
         
         Args:
             blueprint_name: Name of the target Blueprint
-            property_name: Name of the property to set
+            property_name: Property name or path, e.g. "Tags[0]" or "Mesh.BodyInstance.MassInKgOverride"
             property_value: Value to set the property to
             
         Returns:
@@ -196,8 +196,25 @@ def register_editor_tools(mcp: FastMCP):
             return {}
     
     @mcp.tool()
-    def get_actor_properties(ctx: Context, name: str) -> Dict[str, Any]:
-        """Get all properties of an actor."""
+    def get_actor_properties(
+        ctx: Context,
+        name: str,
+        depth: int = 1,
+        categories: List[str] = [],
+        include_components: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Get all editable properties of an actor and its components.
+        
+        Args:
+            name: Name of the actor
+            depth: How many levels of structs and containers to expand (deeper values are returned as text)
+            categories: Only return properties in these categories, e.g. ["Physics", "Rendering"]
+            include_components: Whether to include the properties of the actor's components
+            
+        Returns:
+            Dict containing the actor's transform, properties and components
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -205,10 +222,16 @@ def register_editor_tools(mcp: FastMCP):
             if not unreal:
                 logger.error("Failed to connect to Unreal Engine")
                 return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "name": name,
+                "depth": depth,
+                "include_components": include_components
+            }
+            if categories:
+                params["categories"] = categories
                 
-            response = unreal.send_command("get_actor_properties", {
-                "name": name
-            })
+            response = unreal.send_command("get_actor_properties", params)
             return response or {}
             
         except Exception as e:
@@ -227,7 +250,7 @@ def register_editor_tools(mcp: FastMCP):
         
         Args:
             name: Name of the actor
-            property_name: Name of the property to set
+            property_name: Property name or path, e.g. "Tags[2]" or "StaticMeshComponent.BodyInstance.MassInKgOverride"
             property_value: Value to set the property to
             
         Returns:
@@ -259,6 +282,45 @@ def register_editor_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def set_actor_materials(
+        ctx: Context,
+        assignments: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Assign materials to the mesh components of many actors in one pass.
+        
+        Args:
+            assignments: List of {"actor": "Rock_01", "material": "MI_Rock_Wet", "slot": 0 or "SlotName",
+                         "component": optional mesh component name; all mesh components when omitted}
+            
+        Returns:
+            Dict containing the applied changes and per-assignment errors
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+                
+            response = unreal.send_command("set_actor_materials", {
+                "assignments": assignments
+            })
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Set actor materials response: {response.get('result', {}).get('count', 0)} changes")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error setting actor materials: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     # @mcp.tool() commented out because it's buggy
     def focus_viewport(
         ctx: Context,
@@ -366,4 +428,37 @@ def register_editor_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def wait_for_saves(ctx: Context) -> Dict[str, Any]:
+        """
+        Wait until every queued asset save has been written to disk.
+        
+        Commands that modify assets queue their saves and return without waiting for the disk write.
+        Call this before reading the saved files or handing them to other tools.
+        
+        Returns:
+            Dict with the saved and failed package names since the last call
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            response = unreal.send_command("wait_for_saves", {})
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Wait for saves response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error waiting for saves: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     logger.info("Editor tools registered successfully")
@@ -281,6 +281,60 @@ def register_blueprint_node_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def add_blueprint_variables(
+        ctx: Context,
+        blueprint_name: str,
+        variables: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Add several variables to a Blueprint in one structural change.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            variables: List of variable specs, each with:
+                name: Name of the variable
+                type: A type name ("Boolean", "Float", "Vector", ...) or an object
+                      {"category", "sub_type", "container", "value_type"}, e.g.
+                      {"category": "Object", "sub_type": "Actor", "container": "Array"}
+                default_value: Optional default (string in property text format, number, bool or [X, Y, Z])
+                category: Optional category shown in the My Blueprint panel
+                tooltip: Optional tooltip
+                instance_editable, read_only, expose_on_spawn, private: Optional flags
+                replication: Optional "none", "replicated" or "rep_notify"
+                replication_condition: Optional lifetime condition (e.g. "COND_OwnerOnly")
+            
+        Returns:
+            Per-variable results and the number of variables added
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "variables": variables
+            }
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            logger.info(f"Adding {len(variables)} variables to blueprint '{blueprint_name}'")
+            response = unreal.send_command("add_blueprint_variables", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Variable batch response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error adding variables: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     @mcp.tool()
     def add_blueprint_get_self_component_reference(
         ctx: Context,
@@ -385,27 +439,60 @@ def register_blueprint_node_tools(mcp: FastMCP):
         ctx: Context,
         blueprint_name: str,
         node_type = None,
-        event_type = None
+        event_type = None,
+        node_class: str = "",
+        function_name: str = "",
+        variable_name: str = "",
+        graph_name: str = "",
+        comment: str = "",
+        title: str = "",
+        unconnected_pin: str = "",
+        include_pins: bool = False,
+        limit: int = 100
     ) -> Dict[str, Any]:
         """
-        Find nodes in a Blueprint's event graph.
+        Find nodes in any graph of a Blueprint. Every filter given must match.
         
         Args:
             blueprint_name: Name of the target Blueprint
-            node_type: Optional type of node to find (Event, Function, Variable, etc.)
-            event_type: Optional specific event type to find (BeginPlay, Tick, etc.)
+            node_type: Optional type of node to find (Event, Function, Variable, InputAction or Self)
+            event_type: Optional specific event to find (BeginPlay, Tick, or a custom event name)
+            node_class: Optional node class, subclasses included (e.g. "K2Node_CallFunction" or "CallFunction")
+            function_name: Optional function the node calls or implements
+            variable_name: Optional variable the node gets or sets
+            graph_name: Optional graph to search; all graphs when empty
+            comment: Optional text the node comment must contain
+            title: Optional text the node title must contain
+            unconnected_pin: Optional pin kind that must have an unconnected pin
+                             (exec_input, exec_output, data_input or data_output)
+            include_pins: Include a summary of each node's visible pins
+            limit: Maximum number of nodes to return
             
         Returns:
-            Response containing array of found node IDs and success status
+            Matching node GUIDs, node summaries and the total match count
         """
         from unreal_mcp_server import get_unreal_connection
         
         try:
             params = {
                 "blueprint_name": blueprint_name,
-                "node_type": node_type,
-                "event_type": event_type
+                "include_pins": include_pins,
+                "limit": limit
             }
+            if node_type:
+                params["node_type"] = node_type
+            if event_type:
+                params["event_type"] = event_type
+            optional_filters = {
+                "node_class": node_class,
+                "function_name": function_name,
+                "variable_name": variable_name,
+                "graph_name": graph_name,
+                "comment": comment,
+                "title": title,
+                "unconnected_pin": unconnected_pin
+            }
+            params.update({key: value for key, value in optional_filters.items() if value})
             
             unreal = get_unreal_connection()
             if not unreal:
@@ -427,4 +514,218 @@ def register_blueprint_node_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def get_blueprint_graph(
+        ctx: Context,
+        blueprint_name: str,
+        graph_name: str = "",
+        offset: int = 0,
+        limit: int = 500
+    ) -> Dict[str, Any]:
+        """
+        Read the graphs of a Blueprint: nodes with their GUIDs, positions, pins, pin types, defaults and links.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            graph_name: Optional graph to read (e.g. "EventGraph"); all graphs when empty
+            offset: Index of the first node to return, counted across graphs
+            limit: Maximum number of nodes to return
+            
+        Returns:
+            Graphs with their node counts and the requested page of nodes; next_offset is set when more remain
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "offset": offset,
+                "limit": limit
+            }
+            if graph_name:
+                params["graph_name"] = graph_name
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            logger.info(f"Getting graph of blueprint '{blueprint_name}'")
+            response = unreal.send_command("get_blueprint_graph", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Got graph with {response.get('result', {}).get('total_nodes', 0)} nodes")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error getting graph: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
+    @mcp.tool()
+    def export_graph_nodes(
+        ctx: Context,
+        blueprint_name: str,
+        graph_name: str = "",
+        node_ids: List[str] = None,
+        file_path: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Export nodes of a Blueprint graph in the editor's copy/paste text format.
+        
+        Args:
+            blueprint_name: Name of the source Blueprint
+            graph_name: Optional graph to export from; the event graph when empty
+            node_ids: Optional GUIDs of the nodes to export; the whole graph when omitted
+            file_path: Optional file to write the text to instead of returning it, inside the project's Saved directory
+                       (relative paths are relative to it)
+            
+        Returns:
+            The exported text (or file path) and the number of nodes exported
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "blueprint_name": blueprint_name
+            }
+            if graph_name:
+                params["graph_name"] = graph_name
+            if node_ids:
+                params["node_ids"] = node_ids
+            if file_path:
+                params["file_path"] = file_path
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            logger.info(f"Exporting nodes from blueprint '{blueprint_name}'")
+            response = unreal.send_command("export_graph_nodes", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Exported {response.get('result', {}).get('node_count', 0)} nodes")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error exporting nodes: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
+    @mcp.tool()
+    def import_graph_nodes(
+        ctx: Context,
+        blueprint_name: str,
+        text: str = "",
+        file_path: str = "",
+        graph_name: str = "",
+        offset: List[float] = None,
+        regenerate_guids: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Paste nodes in the editor's copy/paste text format into a Blueprint graph in one operation.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            text: Node text, as produced by export_graph_nodes or copied in the editor
+            file_path: File to read the node text from instead of text, inside the project's Saved directory
+            graph_name: Optional graph to paste into; the event graph when empty
+            offset: Optional [X, Y] added to the node positions stored in the text
+            regenerate_guids: Give the pasted nodes new GUIDs (default True)
+            
+        Returns:
+            The pasted nodes with their new and source GUIDs
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "regenerate_guids": regenerate_guids
+            }
+            if file_path:
+                params["file_path"] = file_path
+            else:
+                params["text"] = text
+            if graph_name:
+                params["graph_name"] = graph_name
+            if offset is not None:
+                params["offset"] = offset
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            logger.info(f"Importing nodes into blueprint '{blueprint_name}'")
+            response = unreal.send_command("import_graph_nodes", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Imported {response.get('result', {}).get('imported_count', 0)} nodes")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error importing nodes: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
+    @mcp.tool()
+    def layout_graph(
+        ctx: Context,
+        blueprint_name: str,
+        graph_name: str = "",
+        spacing: List[float] = None
+    ) -> Dict[str, Any]:
+        """
+        Arrange the nodes of a Blueprint graph in layers that follow its exec and data links.
+        
+        Args:
+            blueprint_name: Name of the target Blueprint
+            graph_name: Optional graph to lay out; the event graph when empty
+            spacing: Optional [X, Y] gap between columns and between stacked nodes (default [80, 40])
+            
+        Returns:
+            Number of nodes, chains and layers laid out, and the time taken
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            params = {
+                "blueprint_name": blueprint_name
+            }
+            if graph_name:
+                params["graph_name"] = graph_name
+            if spacing is not None:
+                params["spacing"] = spacing
+            
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            logger.info(f"Laying out graph of blueprint '{blueprint_name}'")
+            response = unreal.send_command("layout_graph", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Graph layout response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error laying out graph: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     logger.info("Blueprint node tools registered successfully")
\ No newline at end of file
@@ -5,7 +5,7 @@ This module provides tools for managing project-wide settings and configuration.
 """
 
 import logging
-from typing import Dict, Any
+from typing import Dict, List, Any
 from mcp.server.fastmcp import FastMCP, Context
 
 # Get logger
@@ -61,4 +61,109 @@ def register_project_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def create_input_mappings(
+        ctx: Context,
+        mappings: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Create many input mappings at once, saving the input config a single time.
+        
+        Args:
+            mappings: List of mappings, each with:
+                name: Name of the action or axis
+                key: Key to bind (SpaceBar, LeftMouseButton, Gamepad_LeftX, etc.)
+                type: "Action" (default) or "Axis"
+                shift, ctrl, alt, cmd: Modifier keys (actions only)
+                scale: Axis scale (axes only, default 1.0)
+            
+        Returns:
+            Dict containing the created mappings and the skipped ones (duplicates, unknown keys) with reasons
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "mappings": mappings
+            }
+            
+            logger.info(f"Creating {len(mappings)} input mappings")
+            response = unreal.send_command("create_input_mappings", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Input mappings creation response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error creating input mappings: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
+    @mcp.tool()
+    def create_enhanced_input(
+        ctx: Context,
+        actions: List[Dict[str, Any]] = None,
+        mapping_context: Dict[str, Any] = None,
+        path: str = "/Game/Input",
+        overwrite: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Create Enhanced Input action assets and a mapping context from one spec, saving them in a single pass.
+        
+        Args:
+            actions: Input actions, each with:
+                name: Asset name, e.g. "IA_Move"
+                value_type: "Boolean" (default), "Axis1D", "Axis2D" or "Axis3D"
+                triggers, modifiers: Lists of types ("Pressed", "Negate") or objects with a type and
+                                     properties ({"type": "Hold", "HoldTimeThreshold": 0.5})
+                description, consume_input: Optional action settings
+            mapping_context: {"name": "IMC_Default", "mappings": [{"action", "key", "triggers", "modifiers"}]}
+                Mapped actions come from this batch or existing actions in the same folder
+            path: Content folder for the assets
+            overwrite: Reconfigure existing actions and replace the context's mappings instead of keeping them
+            
+        Returns:
+            Dict containing the actions and mapping context with their status (created, updated or existing)
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "path": path,
+                "overwrite": overwrite
+            }
+            
+            if actions:
+                params["actions"] = actions
+            if mapping_context:
+                params["mapping_context"] = mapping_context
+            
+            logger.info(f"Creating {len(actions or [])} input actions in {path}")
+            response = unreal.send_command("create_enhanced_input", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Enhanced input creation response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error creating enhanced input assets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+    
     logger.info("Project tools registered successfully") 
\ No newline at end of file
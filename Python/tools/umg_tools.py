@@ -330,4 +330,123 @@ def register_umg_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def build_widget_tree(
+        ctx: Context,
+        blueprint_name: str,
+        root: Dict[str, Any],
+        replace: bool = False,
+        parent: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Build a whole widget hierarchy in one command, compiling and saving the Widget Blueprint once.
+        
+        Args:
+            blueprint_name: Name or content path (e.g. "/Game/UI/WBP_Hud") of the target Widget Blueprint
+            root: Widget spec, nested through "children". Each spec has:
+                type: Widget class, e.g. "CanvasPanel", "VerticalBox", "HorizontalBox", "GridPanel",
+                      "UniformGridPanel", "Overlay", "ScrollBox", "SizeBox", "Border", "TextBlock", "Button", "Image"
+                name: Widget name (optional)
+                text, font_size, color: Text of a TextBlock, or of the label created inside a Button
+                background_color: Button background color [R, G, B, A]
+                properties: Other widget properties by name, e.g. {"Visibility": "Hidden"}
+                slot: Layout in the parent panel: position, size, anchors [minX, minY(, maxX, maxY)], offsets,
+                      alignment, auto_size, z_order (canvas); padding, h_align, v_align, size_rule ("auto"/"fill"),
+                      fill (box); row, column, row_span, column_span (grid)
+                events: Widget events to bind, e.g. ["OnClicked"]
+                bindings: Widget property to function graph, e.g. {"Text": "GetScoreText"}
+                is_variable: Expose the widget as a variable (implied by events and bindings)
+                children: Child widget specs (panels only)
+            replace: Replace the existing widget tree instead of adding to it. Bound events and property
+                     bindings of widgets that are not rebuilt are removed and listed in the result
+            parent: Panel to add the new tree to when not replacing (default: the root widget)
+            
+        Returns:
+            Dict containing the created widgets, non-fatal errors and the compile result
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "blueprint_name": blueprint_name,
+                "root": root,
+                "replace": replace
+            }
+            
+            if parent:
+                params["parent"] = parent
+            
+            logger.info(f"Building widget tree in {blueprint_name}")
+            response = unreal.send_command("build_widget_tree", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Build widget tree response: {response}")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error building widget tree: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_widget_tree(
+        ctx: Context,
+        blueprint_name: str,
+        root: str = "",
+        widget_class: str = "",
+        refresh: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Get the widget hierarchy of a Widget Blueprint, in the spec format build_widget_tree accepts.
+        
+        Args:
+            blueprint_name: Name or content path of the Widget Blueprint
+            root: Only return the subtree under this widget
+            widget_class: Return a flat list of widgets of this class (e.g. "TextBlock") instead of the tree
+            refresh: Bypass the cached export
+            
+        Returns:
+            Dict containing the tree (or the matching widgets) with slot layout, visibility, text, events and bindings
+        """
+        from unreal_mcp_server import get_unreal_connection
+        
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+            
+            params = {
+                "blueprint_name": blueprint_name,
+                "refresh": refresh
+            }
+            
+            if root:
+                params["root"] = root
+            if widget_class:
+                params["widget_class"] = widget_class
+            
+            logger.info(f"Getting widget tree with params: {params}")
+            response = unreal.send_command("get_widget_tree", params)
+            
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+            
+            logger.info(f"Get widget tree response: {response.get('result', {}).get('widget_count', 0)} widgets")
+            return response
+            
+        except Exception as e:
+            error_msg = f"Error getting widget tree: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     logger.info("UMG tools registered successfully") 
\ No newline at end of file
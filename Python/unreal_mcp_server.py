@@ -271,6 +271,7 @@ from tools.blueprint_tools import register_blueprint_tools
 from tools.node_tools import register_blueprint_node_tools
 from tools.project_tools import register_project_tools
 from tools.umg_tools import register_umg_tools
+from tools.asset_tools import register_asset_tools
 
 # Register tools
 register_editor_tools(mcp)
@@ -278,6 +279,7 @@ register_blueprint_tools(mcp)
 register_blueprint_node_tools(mcp)
 register_project_tools(mcp)
 register_umg_tools(mcp)  
+register_asset_tools(mcp)
 
 @mcp.prompt()
 def info():
@@ -311,6 +313,7 @@ def info():
     - `delete_actor(name)` - Remove actors
     - `set_actor_transform(name, location, rotation, scale)` - Modify actor transform
     - `get_actor_properties(name)` - Get actor properties
+    - `set_actor_materials(assignments)` - Assign materials to many actors' mesh components at once
     
     ## Blueprint Management
     - `create_blueprint(name, parent_class)` - Create new Blueprint classes
@@ -335,6 +338,14 @@ def info():
     ## Project Tools
     - `create_input_mapping(action_name, key, input_type)` - Create input mappings
     
+    ## Asset Tools
+    - `find_assets(path, asset_class, name, tags, fields, limit, cursor)` - Find assets without loading them
+    - `suggest(query, kind, limit)` - Suggest asset and class names close to a misspelled name
+    - `get_asset_dependencies(asset, depth, hard, soft, searchable_names)` - What an asset pulls in
+    - `get_asset_referencers(asset, depth, hard, soft, searchable_names)` - What references an asset, before deleting or moving it
+    - `move_assets(moves)` / `rename_assets(renames)` - Reorganize many assets in one batch with a single redirector fixup
+    - `create_material_instances(parent, instances, path)` - Create many material instances with parameter overrides
+    
     ## Best Practices
     
     ### UMG Widget Development